@@ -192,7 +192,7 @@ struct function_record {
     function_record()
         : is_constructor(false), is_new_style_constructor(false), is_stateless(false),
           is_operator(false), is_method(false), is_setter(false), has_args(false),
-          has_kwargs(false), prepend(false) {}
+          has_kwargs(false), prepend(false), positional_only_call(false) {}
 
     /// Function name
     char *name = nullptr; /* why no C++ strings? They generate heavier code.. */
@@ -245,6 +245,11 @@ struct function_record {
     /// True if this function is to be inserted at the beginning of the overload resolution chain
     bool prepend : 1;
 
+    /// True if all parameters are positional (no py::args, py::kwargs or keyword-only arguments)
+    /// and this is not a constructor: a call passing exactly `nargs` positional arguments and
+    /// no keywords then needs no overload resolution, unless further overloads get chained on
+    bool positional_only_call : 1;
+
     /// Number of arguments (including py::args and/or py::kwargs, if present)
     std::uint16_t nargs;
 
@@ -266,6 +271,13 @@ struct function_record {
 
     /// Pointer to next overload
     function_record *next = nullptr;
+
+    /// Tuple of the argument names as interned Python strings (None for unnamed arguments),
+    /// used to match keyword arguments without creating temporary strings
+    handle arg_names;
+
+    /// Interned name of argument `i`; only valid if that argument has a name
+    PyObject *arg_name(size_t i) const { return PyTuple_GET_ITEM(arg_names.ptr(), (ssize_t) i); }
 };
 
 /// Special data structure which (temporarily) holds metadata about a bound class
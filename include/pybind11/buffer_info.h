@@ -182,6 +182,63 @@ private:
     bool ownview = false;
 };
 
+/// Allocation-free alternative to ``buffer_info`` for reading a buffer exported by another object
+/// (see ``buffer::view()``). The ``Py_buffer`` is stored inline and shape, strides and format are
+/// read straight from the exporter, so acquiring a view never touches the heap. The buffer is
+/// released when the view is destroyed.
+class buffer_view {
+public:
+    buffer_view() = default;
+
+    buffer_view(const buffer_view &) = delete;
+    buffer_view &operator=(const buffer_view &) = delete;
+
+    buffer_view(buffer_view &&other) noexcept : m_view(other.m_view) { other.m_view.obj = nullptr; }
+
+    buffer_view &operator=(buffer_view &&rhs) noexcept {
+        if (this != &rhs) {
+            release();
+            m_view = rhs.m_view;
+            rhs.m_view.obj = nullptr;
+        }
+        return *this;
+    }
+
+    ~buffer_view() { release(); }
+
+    void *ptr() const { return m_view.buf; }
+    ssize_t itemsize() const { return m_view.itemsize; }
+    ssize_t size() const { return m_view.itemsize != 0 ? m_view.len / m_view.itemsize : 0; }
+    ssize_t ndim() const { return m_view.ndim; }
+    ssize_t shape(ssize_t dim) const { return m_view.shape[dim]; }
+    // Exporters such as ctypes leave `strides` NULL for C-contiguous data
+    ssize_t strides(ssize_t dim) const {
+        if (m_view.strides != nullptr) {
+            return m_view.strides[dim];
+        }
+        ssize_t stride = m_view.itemsize;
+        for (ssize_t i = m_view.ndim - 1; i > dim; --i) {
+            stride *= m_view.shape[i];
+        }
+        return stride;
+    }
+    const char *format() const { return m_view.format != nullptr ? m_view.format : "B"; }
+    bool readonly() const { return m_view.readonly != 0; }
+
+    explicit operator bool() const { return m_view.obj != nullptr; }
+
+    Py_buffer *view() { return &m_view; }
+
+private:
+    void release() {
+        if (m_view.obj != nullptr) {
+            PyBuffer_Release(&m_view);
+        }
+    }
+
+    Py_buffer m_view{};
+};
+
 PYBIND11_NAMESPACE_BEGIN(detail)
 
 template <typename T, typename SFINAE>
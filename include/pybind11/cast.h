@@ -32,6 +32,116 @@ PYBIND11_NAMESPACE_BEGIN(PYBIND11_NAMESPACE)
 
 PYBIND11_WARNING_DISABLE_MSVC(4127)
 
+/// Holder for types that carry their own reference count. The count is manipulated through the
+/// free functions ``intrusive_ptr_add_ref(T *)`` and ``intrusive_ptr_release(T *)``, found by
+/// argument-dependent lookup (the same protocol as ``boost::intrusive_ptr``). The holder is a
+/// single pointer: it shares the instance's value pointer slot rather than occupying a holder
+/// slot of its own, and wrapping a raw pointer that is already owned elsewhere in C++ simply
+/// adds a reference to the existing count.
+template <typename T>
+class intrusive_ptr {
+public:
+    using element_type = T;
+
+    intrusive_ptr() = default;
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    intrusive_ptr(std::nullptr_t) {}
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    intrusive_ptr(T *p, bool add_ref = true) : ptr(p) {
+        if (ptr != nullptr && add_ref) {
+            intrusive_ptr_add_ref(ptr);
+        }
+    }
+    intrusive_ptr(const intrusive_ptr &other) : intrusive_ptr(other.ptr) {}
+    intrusive_ptr(intrusive_ptr &&other) noexcept : ptr(other.ptr) { other.ptr = nullptr; }
+    template <typename U, detail::enable_if_t<std::is_convertible<U *, T *>::value, int> = 0>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    intrusive_ptr(const intrusive_ptr<U> &other) : intrusive_ptr(other.get()) {}
+    /// Aliasing constructor, used when loading a holder through a base class with a pointer
+    /// offset; the count lives in the object, so this just references ``p``.
+    template <typename U>
+    intrusive_ptr(const intrusive_ptr<U> & /* owner */, T *p) : intrusive_ptr(p) {}
+    ~intrusive_ptr() {
+        if (ptr != nullptr) {
+            intrusive_ptr_release(ptr);
+        }
+    }
+
+    intrusive_ptr &operator=(const intrusive_ptr &other) {
+        intrusive_ptr(other).swap(*this);
+        return *this;
+    }
+    intrusive_ptr &operator=(intrusive_ptr &&other) noexcept {
+        intrusive_ptr(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    T *get() const { return ptr; }
+    T &operator*() const { return *ptr; }
+    T *operator->() const { return ptr; }
+    explicit operator bool() const { return ptr != nullptr; }
+
+    void reset(T *p = nullptr, bool add_ref = true) { intrusive_ptr(p, add_ref).swap(*this); }
+    /// Gives up ownership without decrementing the count and returns the raw pointer
+    T *detach() {
+        T *p = ptr;
+        ptr = nullptr;
+        return p;
+    }
+    void swap(intrusive_ptr &other) noexcept { std::swap(ptr, other.ptr); }
+
+private:
+    T *ptr = nullptr;
+};
+
+/** \rst
+    Holder for objects that live inside an arena owned by another Python object, such as the
+    nodes of a parse tree or the faces of a mesh. It pairs the raw pointer with a strong
+    reference to that *anchor*, so every wrapper around arena memory keeps the arena alive
+    through its own holder: no ``keep_alive`` patients are recorded (unlike
+    ``return_value_policy::reference_internal``), and the arena is freed in one go once the last
+    wrapper is gone. Like ``py::object``, an ``arena_ref`` may only be copied or destroyed while
+    holding the GIL.
+\endrst */
+template <typename T>
+class arena_ref {
+public:
+    using element_type = T;
+
+    arena_ref() = default;
+    /// References ``p``, which lives in the memory owned by ``anchor``
+    arena_ref(T *p, object anchor) : ptr(p), anchor_obj(std::move(anchor)) {}
+    /// Takes ownership of a heap-allocated ``p`` that is not part of any arena (e.g. a node that
+    /// was returned by value); ``p`` becomes its own anchor and is deleted with it.
+    explicit arena_ref(T *p)
+        : ptr(p),
+          anchor_obj(p != nullptr ? capsule(p, [](void *o) { delete static_cast<T *>(o); })
+                                  : object()) {}
+    template <typename U, detail::enable_if_t<std::is_convertible<U *, T *>::value, int> = 0>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    arena_ref(const arena_ref<U> &other) : arena_ref(other.get(), other.anchor()) {}
+    /// Aliasing constructor: references ``p`` through the anchor of ``owner``
+    template <typename U>
+    arena_ref(const arena_ref<U> &owner, T *p) : arena_ref(p, owner.anchor()) {}
+
+    T *get() const { return ptr; }
+    T &operator*() const { return *ptr; }
+    T *operator->() const { return ptr; }
+    explicit operator bool() const { return ptr != nullptr; }
+
+    /// The Python object that owns the referenced memory
+    const object &anchor() const { return anchor_obj; }
+    /// Returns a reference to another object ``p`` in the same arena
+    template <typename U>
+    arena_ref<U> rebind(U *p) const {
+        return arena_ref<U>(p, anchor_obj);
+    }
+
+private:
+    T *ptr = nullptr;
+    object anchor_obj;
+};
+
 PYBIND11_NAMESPACE_BEGIN(detail)
 
 template <typename type, typename SFINAE = void>
@@ -622,6 +732,73 @@ public:
     using cast_op_type = pybind11::detail::cast_op_type<_T>;
 };
 
+PYBIND11_NAMESPACE_END(detail)
+
+/// Return type for functions that produce one of a limited set of strings (names, labels,
+/// categories). The Python `str` for each distinct value is created once, interned and then
+/// taken from a bounded cache instead of being decoded again on every call.
+class interned_str {
+public:
+    interned_str() = default;
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    interned_str(std::string value) : value_(std::move(value)) {}
+    /// Like a returned `const char *`, the string is not copied and must outlive the conversion
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    interned_str(const char *value) : c_str_(value) {}
+
+    const char *data() const { return c_str_ != nullptr ? c_str_ : value_.data(); }
+    size_t size() const { return c_str_ != nullptr ? std::strlen(c_str_) : value_.size(); }
+
+private:
+    std::string value_;
+    const char *c_str_ = nullptr;
+};
+
+PYBIND11_NAMESPACE_BEGIN(detail)
+
+/// Returns a new reference to a Python `str` with the given UTF-8 contents, taken from (or
+/// added to) the `interned_str_cache`
+PYBIND11_NOINLINE handle cached_str(const char *data, size_t size) {
+    size_t hash = 2166136261u; // FNV-1a
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 16777619u;
+    }
+    PyObject *&slot = get_interned_str_cache().strings[hash % interned_str_cache::slots];
+    if (slot) {
+        Py_ssize_t cached_size = -1;
+        const char *cached = PyUnicode_AsUTF8AndSize(slot, &cached_size);
+        if (cached && (size_t) cached_size == size && std::memcmp(cached, data, size) == 0) {
+            return handle(slot).inc_ref();
+        }
+    }
+    PyObject *s = PyUnicode_DecodeUTF8(data, (ssize_t) size, nullptr);
+    if (!s) {
+        throw error_already_set();
+    }
+    PyUnicode_InternInPlace(&s);
+    Py_XDECREF(slot);
+    slot = s;
+    return handle(s).inc_ref();
+}
+
+template <>
+struct type_caster<interned_str> {
+    bool load(handle src, bool convert) {
+        make_caster<std::string> str_caster;
+        if (!str_caster.load(src, convert)) {
+            return false;
+        }
+        value = cast_op<std::string &&>(std::move(str_caster));
+        return true;
+    }
+
+    static handle cast(const interned_str &src, return_value_policy, handle) {
+        return cached_str(src.data(), src.size());
+    }
+
+    PYBIND11_TYPE_CASTER(interned_str, const_name(PYBIND11_STRING_NAME));
+};
+
 // Base implementation for std::tuple and std::pair
 template <template <typename...> class Tuple, typename... Ts>
 class tuple_caster {
@@ -777,7 +954,7 @@ protected:
     bool load_value(value_and_holder &&v_h) {
         if (v_h.holder_constructed()) {
             value = v_h.value_ptr();
-            holder = v_h.template holder<holder_type>();
+            load_holder(v_h, holder_in_value_slot<holder_type>{});
             return true;
         }
         throw cast_error("Unable to cast from non-held to held instance (T& to Holder<T>) "
@@ -790,6 +967,19 @@ protected:
 #endif
     }
 
+    void load_holder(const value_and_holder &v_h, std::false_type) {
+        holder = v_h.template holder<holder_type>();
+    }
+    // A value slot holder is the instance's value pointer, which points to `type` only if this
+    // caster's type is the instance's. Otherwise this is a sub-caster of try_implicit_casts()
+    // and the caller rebuilds the holder from the pointer adjusted to the base, so reading the
+    // most derived pointer as a `type *` (wrong for a non-primary base) must be avoided.
+    void load_holder(const value_and_holder &v_h, std::true_type) {
+        if (same_type(*typeinfo->cpptype, typeid(type))) {
+            holder = holder_type(v_h.value_ptr<type>());
+        }
+    }
+
     template <typename T = holder_type,
               detail::enable_if_t<!std::is_constructible<T, const T &, type *>::value, int> = 0>
     bool try_implicit_casts(handle, bool) {
@@ -848,6 +1038,17 @@ struct always_construct_holder {
     static constexpr bool value = Value;
 };
 
+template <typename T>
+class type_caster<intrusive_ptr<T>> : public copyable_holder_caster<T, intrusive_ptr<T>> {};
+// The object owns its count, so even non-owning casts can safely take a reference to it
+template <typename T>
+struct always_construct_holder<intrusive_ptr<T>> : always_construct_holder<void, true> {};
+template <typename T>
+struct holder_in_value_slot<intrusive_ptr<T>> : std::true_type {};
+
+template <typename T>
+class type_caster<arena_ref<T>> : public copyable_holder_caster<T, arena_ref<T>> {};
+
 /// Create a specialization for custom holder types (silently ignores std::shared_ptr)
 #define PYBIND11_DECLARE_HOLDER_TYPE(type, holder_type, ...)                                      \
     PYBIND11_NAMESPACE_BEGIN(PYBIND11_NAMESPACE)                                                  \
@@ -25,7 +25,22 @@ PYBIND11_NAMESPACE_BEGIN(detail)
         setattr((PyObject *) obj, "__qualname__", nameobj)
 #endif
 
-inline std::string get_fully_qualified_tp_name(PyTypeObject *type) {
+#if defined(PYBIND11_RUNTIME_DECLARATIONS_ONLY)
+
+// Defined in the pybind11::runtime library; the functions only used from there are omitted.
+PYBIND11_RUNTIME_INLINE std::string get_fully_qualified_tp_name(PyTypeObject *type);
+PYBIND11_RUNTIME_INLINE void register_instance(instance *self,
+                                               void *valptr,
+                                               const type_info *tinfo);
+PYBIND11_RUNTIME_INLINE PyObject *make_new_instance(PyTypeObject *type);
+PYBIND11_RUNTIME_INLINE void add_patient(PyObject *nurse, PyObject *patient);
+PYBIND11_RUNTIME_INLINE PyObject *make_new_python_type(const type_record &rec);
+PYBIND11_RUNTIME_INLINE size_t instance_sizeof(instance *self);
+PYBIND11_RUNTIME_INLINE PyObject *make_method_descriptor(PyObject *func);
+
+#else
+
+PYBIND11_RUNTIME_INLINE std::string get_fully_qualified_tp_name(PyTypeObject *type) {
 #if !defined(PYPY_VERSION)
     return type->tp_name;
 #else
@@ -61,7 +76,7 @@ inline void enable_dynamic_attributes(PyHeapTypeObject *heap_type);
 /** A `static_property` is the same as a `property` but the `__get__()` and `__set__()`
     methods are modified to always use the object type instead of a concrete instance.
     Return value: New reference. */
-inline PyTypeObject *make_static_property_type() {
+PYBIND11_RUNTIME_INLINE PyTypeObject *make_static_property_type() {
     constexpr auto *name = "pybind11_static_property";
     auto name_obj = reinterpret_steal<object>(PYBIND11_FROM_STRING(name));
 
@@ -108,7 +123,7 @@ inline PyTypeObject *make_static_property_type() {
 /** PyPy has some issues with the above C API, so we evaluate Python code instead.
     This function will only be called once so performance isn't really a concern.
     Return value: New reference. */
-inline PyTypeObject *make_static_property_type() {
+PYBIND11_RUNTIME_INLINE PyTypeObject *make_static_property_type() {
     auto d = dict();
     PyObject *result = PyRun_String(R"(\
 class pybind11_static_property(property):
@@ -130,6 +145,164 @@ class pybind11_static_property(property):
 
 #endif // PYPY
 
+#if !defined(PYPY_VERSION)
+
+inline method_descriptor *as_method_descriptor(PyObject *self) {
+    return reinterpret_cast<method_descriptor *>(self);
+}
+
+/// `pybind11_method.__get__()`: bind to an instance. Accessed through the class, the descriptor
+/// returns itself, so that `cls.attr("m2") = cls.attr("m1")` aliases the method.
+extern "C" inline PyObject *pybind11_method_get(PyObject *self, PyObject *obj, PyObject *) {
+    if (obj == nullptr || obj == Py_None) {
+        Py_INCREF(self);
+        return self;
+    }
+    return PyMethod_New(as_method_descriptor(self)->func, obj);
+}
+
+/// `pybind11_method.__call__()`: call the function, with `self` as the first argument
+extern "C" inline PyObject *pybind11_method_call(PyObject *self, PyObject *args, PyObject *kwargs) {
+    return PyObject_Call(as_method_descriptor(self)->func, args, kwargs);
+}
+
+#    if PY_VERSION_HEX >= 0x03090000
+/// Vectorcall entry point, used by `obj.method(...)` calls through the method descriptor
+/// protocol. The arguments (including `self`) are passed on unchanged.
+extern "C" inline PyObject *pybind11_method_vectorcall(PyObject *self,
+                                                       PyObject *const *args,
+                                                       size_t nargsf,
+                                                       PyObject *kwnames) {
+    return PyObject_Vectorcall(as_method_descriptor(self)->func, args, nargsf, kwnames);
+}
+#    endif
+
+/// Attribute lookup: `__get__`, `__func__`, `__doc__` and the like come from the descriptor;
+/// everything else, including `__module__` (which the type's own `__module__` would shadow),
+/// from the function.
+extern "C" inline PyObject *pybind11_method_getattro(PyObject *self, PyObject *name) {
+    if (_PyType_Lookup(Py_TYPE(self), name) != nullptr
+        && PyUnicode_CompareWithASCIIString(name, "__module__") != 0) {
+        return PyObject_GenericGetAttr(self, name);
+    }
+    return PyObject_GetAttr(as_method_descriptor(self)->func, name);
+}
+
+extern "C" inline PyObject *pybind11_method_get_func(PyObject *self, void *) {
+    PyObject *func = as_method_descriptor(self)->func;
+    Py_INCREF(func);
+    return func;
+}
+
+extern "C" inline PyObject *pybind11_method_get_doc(PyObject *self, void *) {
+    return PyObject_GetAttrString(as_method_descriptor(self)->func, "__doc__");
+}
+
+extern "C" inline PyObject *pybind11_method_repr(PyObject *self) {
+    auto name = reinterpret_steal<object>(
+        PyObject_GetAttrString(as_method_descriptor(self)->func, "__name__"));
+    if (!name) {
+        return nullptr;
+    }
+    return PyUnicode_FromFormat("<pybind11_method '%S'>", name.ptr());
+}
+
+extern "C" inline int pybind11_method_traverse(PyObject *self, visitproc visit, void *arg) {
+    Py_VISIT(as_method_descriptor(self)->func);
+#    if PY_VERSION_HEX >= 0x03090000
+    Py_VISIT(Py_TYPE(self));
+#    endif
+    return 0;
+}
+
+extern "C" inline void pybind11_method_dealloc(PyObject *self) {
+    auto *type = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+    Py_CLEAR(as_method_descriptor(self)->func);
+    type->tp_free(self);
+    Py_DECREF(type);
+}
+
+/** Methods of pybind11 classes are stored in the class dictionary as `pybind11_method`
+    descriptors. The type is flagged as a method descriptor, so that `obj.method(...)` calls
+    it with `obj` as the first argument instead of creating a temporary bound method first.
+    Return value: New reference. */
+PYBIND11_RUNTIME_INLINE PyTypeObject *make_method_descriptor_type() {
+    constexpr auto *name = "pybind11_method";
+    auto name_obj = reinterpret_steal<object>(PYBIND11_FROM_STRING(name));
+
+    auto *heap_type = (PyHeapTypeObject *) PyType_Type.tp_alloc(&PyType_Type, 0);
+    if (!heap_type) {
+        pybind11_fail("make_method_descriptor_type(): error allocating type!");
+    }
+
+    heap_type->ht_name = name_obj.inc_ref().ptr();
+#    ifdef PYBIND11_BUILTIN_QUALNAME
+    heap_type->ht_qualname = name_obj.inc_ref().ptr();
+#    endif
+
+    auto *type = &heap_type->ht_type;
+    type->tp_name = name;
+    type->tp_basicsize = sizeof(method_descriptor);
+    type->tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HEAPTYPE | Py_TPFLAGS_HAVE_GC;
+#    ifdef Py_TPFLAGS_METHOD_DESCRIPTOR
+    type->tp_flags |= Py_TPFLAGS_METHOD_DESCRIPTOR;
+#    endif
+#    if PY_VERSION_HEX >= 0x03090000
+    type->tp_flags |= Py_TPFLAGS_HAVE_VECTORCALL;
+    type->tp_vectorcall_offset = offsetof(method_descriptor, vectorcall);
+#    endif
+    type->tp_descr_get = pybind11_method_get;
+    type->tp_call = pybind11_method_call;
+    type->tp_getattro = pybind11_method_getattro;
+    type->tp_repr = pybind11_method_repr;
+    type->tp_traverse = pybind11_method_traverse;
+    type->tp_dealloc = pybind11_method_dealloc;
+
+    static PyGetSetDef getset[] = {
+        {const_cast<char *>("__func__"), pybind11_method_get_func, nullptr, nullptr, nullptr},
+        {const_cast<char *>("__doc__"), pybind11_method_get_doc, nullptr, nullptr, nullptr},
+        {nullptr, nullptr, nullptr, nullptr, nullptr},
+    };
+    type->tp_getset = getset;
+
+    if (PyType_Ready(type) < 0) {
+        pybind11_fail("PyType_Ready failed in make_method_descriptor_type(): " + error_string());
+    }
+
+    setattr((PyObject *) type, "__module__", str("pybind11_builtins"));
+    PYBIND11_SET_OLDPY_QUALNAME(type, name_obj);
+
+    return type;
+}
+
+#endif // PYPY
+
+/** Wraps a function object for storage as a method in a class dictionary. PyPy has no method
+    descriptor protocol to take advantage of, so there it is a plain `instancemethod`.
+    Return value: New reference. */
+PYBIND11_RUNTIME_INLINE PyObject *make_method_descriptor(PyObject *func) {
+#if defined(PYPY_VERSION)
+    return PyInstanceMethod_New(func);
+#else
+    // Only needed when defining methods, so the type is looked up without a per-module cache
+    auto &type_ptr = get_internals().shared_data["_method_descriptor_type"];
+    if (!type_ptr) {
+        type_ptr = make_method_descriptor_type();
+    }
+    auto *type = static_cast<PyTypeObject *>(type_ptr);
+    auto *self = reinterpret_cast<method_descriptor *>(type->tp_alloc(type, 0));
+    if (!self) {
+        return nullptr;
+    }
+    self->func = handle(func).inc_ref().ptr();
+#    if PY_VERSION_HEX >= 0x03090000
+    self->vectorcall = pybind11_method_vectorcall;
+#    endif
+    return reinterpret_cast<PyObject *>(self);
+#endif
+}
+
 /** Types with static properties need to handle `Type.static_prop = x` in a specific way.
     By default, Python replaces the `static_property` itself, but for wrapped C++ types
     we need to call `static_property.__set__()` in order to propagate the new value to
@@ -227,6 +400,7 @@ extern "C" inline void pybind11_meta_dealloc(PyObject *obj) {
         } else {
             internals.registered_types_cpp.erase(tindex);
         }
+        type_registry_changed();
         internals.registered_types_py.erase(tinfo->type);
 
         // Actually just `std::erase_if`, but that's only available in C++20
@@ -248,7 +422,7 @@ extern "C" inline void pybind11_meta_dealloc(PyObject *obj) {
 /** This metaclass is assigned by default to all pybind11 types and is required in order
     for static properties to function correctly. Users may override this using `py::metaclass`.
     Return value: New reference. */
-inline PyTypeObject *make_default_metaclass() {
+PYBIND11_RUNTIME_INLINE PyTypeObject *make_default_metaclass() {
     constexpr auto *name = "pybind11_type";
     auto name_obj = reinterpret_steal<object>(PYBIND11_FROM_STRING(name));
 
@@ -328,11 +502,41 @@ inline bool deregister_instance_impl(void *ptr, instance *self) {
     return false;
 }
 
-inline void register_instance(instance *self, void *valptr, const type_info *tinfo) {
+PYBIND11_NOINLINE void add_instance_stats(instance_stats_registry &registry,
+                                          const instance *self,
+                                          const type_info *tinfo) {
+    auto &stats = registry.types[tinfo->type];
+    ++stats.count;
+    if (self->owned) {
+        stats.bytes += tinfo->type_size;
+    }
+}
+
+PYBIND11_NOINLINE void remove_instance_stats(instance_stats_registry &registry,
+                                             const instance *self,
+                                             const type_info *tinfo) {
+    // The instance may have been registered before tracking was enabled
+    auto it = registry.types.find(tinfo->type);
+    if (it != registry.types.end()) {
+        if (--it->second.count == 0) {
+            registry.types.erase(it);
+        } else if (self->owned && it->second.bytes >= tinfo->type_size) {
+            it->second.bytes -= tinfo->type_size;
+        }
+    }
+}
+
+PYBIND11_RUNTIME_INLINE void register_instance(instance *self,
+                                               void *valptr,
+                                               const type_info *tinfo) {
     register_instance_impl(valptr, self);
     if (!tinfo->simple_ancestors) {
         traverse_offset_bases(valptr, tinfo, self, register_instance_impl);
     }
+    auto &stats = registered_instance_stats();
+    if (stats.enabled) {
+        add_instance_stats(stats, self, tinfo);
+    }
 }
 
 inline bool deregister_instance(instance *self, void *valptr, const type_info *tinfo) {
@@ -340,13 +544,45 @@ inline bool deregister_instance(instance *self, void *valptr, const type_info *t
     if (!tinfo->simple_ancestors) {
         traverse_offset_bases(valptr, tinfo, self, deregister_instance_impl);
     }
+    if (ret) {
+        auto &stats = registered_instance_stats();
+        if (stats.enabled) {
+            remove_instance_stats(stats, self, tinfo);
+        }
+    }
     return ret;
 }
 
+/// Memory used by a pybind11 instance: the Python object, the value/holder layout if it is
+/// allocated separately, and the C++ values owned by the instance. This is the default
+/// `__sizeof__` of all pybind11 types.
+PYBIND11_RUNTIME_INLINE size_t instance_sizeof(instance *self) {
+    auto *type = Py_TYPE(self);
+    auto size = static_cast<size_t>(type->tp_basicsize);
+    if (!self->simple_layout) {
+        const auto &tinfo = all_type_info(type);
+        size_t space = size_in_ptrs(tinfo.size());
+        for (auto *t : tinfo) {
+            space += 1 + t->holder_size_in_ptrs;
+        }
+        size += space * sizeof(void *);
+    }
+    for (auto &v_h : values_and_holders(self)) {
+        if (v_h && (self->owned || v_h.holder_constructed())) {
+            size += v_h.type->type_size;
+        }
+    }
+    return size;
+}
+
+extern "C" inline PyObject *pybind11_object_sizeof(PyObject *self, PyObject *) {
+    return PyLong_FromSize_t(instance_sizeof(reinterpret_cast<instance *>(self)));
+}
+
 /// Instance creation function for all pybind11 types. It allocates the internal instance layout
 /// for holding C++ objects and holders.  Allocation is done lazily (the first time the instance is
 /// cast to a reference or pointer), and initialization is done by an `__init__` function.
-inline PyObject *make_new_instance(PyTypeObject *type) {
+PYBIND11_RUNTIME_INLINE PyObject *make_new_instance(PyTypeObject *type) {
 #if defined(PYPY_VERSION)
     // PyPy gets tp_basicsize wrong (issue 2482) under multiple inheritance when the first
     // inherited object is a plain Python type (i.e. not derived from an extension type).  Fix it.
@@ -379,7 +615,7 @@ extern "C" inline int pybind11_object_init(PyObject *self, PyObject *, PyObject
     return -1;
 }
 
-inline void add_patient(PyObject *nurse, PyObject *patient) {
+PYBIND11_RUNTIME_INLINE void add_patient(PyObject *nurse, PyObject *patient) {
     auto &internals = get_internals();
     auto *instance = reinterpret_cast<detail::instance *>(nurse);
     instance->has_patients = true;
@@ -478,7 +714,7 @@ std::string error_string();
 /** Create the type which can be used as a common base for all classes.  This is
     needed in order to satisfy Python's requirements for multiple inheritance.
     Return value: New reference. */
-inline PyObject *make_object_base_type(PyTypeObject *metaclass) {
+PYBIND11_RUNTIME_INLINE PyObject *make_object_base_type(PyTypeObject *metaclass) {
     constexpr auto *name = "pybind11_object";
     auto name_obj = reinterpret_steal<object>(PYBIND11_FROM_STRING(name));
 
@@ -506,6 +742,12 @@ inline PyObject *make_object_base_type(PyTypeObject *metaclass) {
     type->tp_init = pybind11_object_init;
     type->tp_dealloc = pybind11_object_dealloc;
 
+    static PyMethodDef methods[] = {
+        {"__sizeof__", pybind11_object_sizeof, METH_NOARGS, nullptr},
+        {nullptr, nullptr, 0, nullptr},
+    };
+    type->tp_methods = methods;
+
     /* Support weak references (needed for the keep_alive feature) */
     type->tp_weaklistoffset = offsetof(instance, weakrefs);
 
@@ -627,7 +869,7 @@ inline void enable_buffer_protocol(PyHeapTypeObject *heap_type) {
 
 /** Create a brand new Python type according to the `type_record` specification.
     Return value: New reference. */
-inline PyObject *make_new_python_type(const type_record &rec) {
+PYBIND11_RUNTIME_INLINE PyObject *make_new_python_type(const type_record &rec) {
     auto name = reinterpret_steal<object>(PYBIND11_FROM_STRING(rec.name));
 
     auto qualname = name;
@@ -652,7 +894,7 @@ inline PyObject *make_new_python_type(const type_record &rec) {
                 rec.name);
 
     char *tp_doc = nullptr;
-    if (rec.doc && options::show_user_defined_docstrings()) {
+    if (rec.doc) {
         /* Allocate memory for docstring (using PyObject_MALLOC, since
            Python will free this later on) */
         size_t size = std::strlen(rec.doc) + 1;
@@ -739,5 +981,7 @@ inline PyObject *make_new_python_type(const type_record &rec) {
     return (PyObject *) type;
 }
 
+#endif // PYBIND11_RUNTIME_DECLARATIONS_ONLY
+
 PYBIND11_NAMESPACE_END(detail)
 PYBIND11_NAMESPACE_END(PYBIND11_NAMESPACE)
@@ -186,6 +186,29 @@
 #    define PYBIND11_NOINLINE __attribute__((noinline)) inline
 #endif
 
+// Non-template functions marked with PYBIND11_RUNTIME_INLINE (declarations and definitions) or
+// PYBIND11_RUNTIME_NOINLINE (definitions only) are part of the optional pybind11::runtime library.
+// By default they are ordinary inline functions. When PYBIND11_RUNTIME is defined (by linking to
+// pybind11::runtime), the headers only declare them and every extension module shares the single
+// compiled copy in the library instead of carrying its own. PYBIND11_RUNTIME_BUILD is only defined
+// while compiling the library itself.
+#if defined(PYBIND11_RUNTIME_BUILD)
+#    define PYBIND11_RUNTIME_INLINE PYBIND11_EXPORT
+#    define PYBIND11_RUNTIME_NOINLINE PYBIND11_EXPORT
+#elif defined(PYBIND11_RUNTIME)
+#    if (defined(WIN32) || defined(_WIN32)) && !defined(PYBIND11_RUNTIME_STATIC)
+#        define PYBIND11_RUNTIME_INLINE __declspec(dllimport)
+#    elif defined(WIN32) || defined(_WIN32)
+#        define PYBIND11_RUNTIME_INLINE
+#    else
+#        define PYBIND11_RUNTIME_INLINE __attribute__((visibility("default")))
+#    endif
+#    define PYBIND11_RUNTIME_DECLARATIONS_ONLY
+#else
+#    define PYBIND11_RUNTIME_INLINE inline
+#    define PYBIND11_RUNTIME_NOINLINE PYBIND11_NOINLINE
+#endif
+
 #if defined(__MINGW32__)
 // For unknown reasons all PYBIND11_DEPRECATED member trigger a warning when declared
 // whether it is used or not
@@ -248,6 +271,10 @@ PYBIND11_WARNING_DISABLE_MSVC(4505)
 #    if defined(PYBIND11_CPP17) && __has_include(<variant>)
 #        define PYBIND11_HAS_VARIANT 1
 #    endif
+// std::span
+#    if defined(PYBIND11_CPP20) && __has_include(<span>)
+#        define PYBIND11_HAS_SPAN 1
+#    endif
 #elif defined(_MSC_VER) && defined(PYBIND11_CPP17)
 #    define PYBIND11_HAS_OPTIONAL 1
 #    define PYBIND11_HAS_VARIANT 1
@@ -1183,7 +1210,7 @@ public:
 };
 
 // Forward-declaration; see detail/class.h
-std::string get_fully_qualified_tp_name(PyTypeObject *);
+PYBIND11_RUNTIME_INLINE std::string get_fully_qualified_tp_name(PyTypeObject *);
 
 template <typename T>
 inline static std::shared_ptr<T>
@@ -34,6 +34,72 @@ private:
     value_and_holder *value = nullptr;
 };
 
+template <typename T, typename SFINAE = void>
+struct has_operator_new : std::false_type {};
+template <typename T>
+struct has_operator_new<T, void_t<decltype(static_cast<void *(*) (size_t)>(T::operator new))>>
+    : std::true_type {};
+/// Allocate storage as `new T` would: through the class-specific operator new if it exists,
+/// otherwise through the global (possibly over-aligned) one.
+template <typename T, enable_if_t<has_operator_new<T>::value, int> = 0>
+void *call_operator_new(size_t s, size_t) {
+    return T::operator new(s);
+}
+template <typename T, enable_if_t<!has_operator_new<T>::value, int> = 0>
+void *call_operator_new(size_t s, size_t a) {
+    (void) a;
+#if defined(__cpp_aligned_new) && (!defined(_MSC_VER) || _MSC_VER >= 1912)
+    if (a > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return ::operator new(s, std::align_val_t(a));
+    }
+#endif
+    return ::operator new(s);
+}
+
+template <typename T, typename SFINAE = void>
+struct has_operator_delete : std::false_type {};
+template <typename T>
+struct has_operator_delete<T, void_t<decltype(static_cast<void (*)(void *)>(T::operator delete))>>
+    : std::true_type {};
+template <typename T, typename SFINAE = void>
+struct has_operator_delete_size : std::false_type {};
+template <typename T>
+struct has_operator_delete_size<
+    T,
+    void_t<decltype(static_cast<void (*)(void *, size_t)>(T::operator delete))>> : std::true_type {
+};
+/// Call class-specific delete if it exists or global otherwise. Can also be an overload set.
+template <typename T, enable_if_t<has_operator_delete<T>::value, int> = 0>
+void call_operator_delete(T *p, size_t, size_t) {
+    T::operator delete(p);
+}
+template <typename T,
+          enable_if_t<!has_operator_delete<T>::value && has_operator_delete_size<T>::value, int>
+          = 0>
+void call_operator_delete(T *p, size_t s, size_t) {
+    T::operator delete(p, s);
+}
+
+inline void call_operator_delete(void *p, size_t s, size_t a) {
+    (void) s;
+    (void) a;
+#if defined(__cpp_aligned_new) && (!defined(_MSC_VER) || _MSC_VER >= 1912)
+    if (a > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+#    ifdef __cpp_sized_deallocation
+        ::operator delete(p, s, std::align_val_t(a));
+#    else
+        ::operator delete(p, std::align_val_t(a));
+#    endif
+        return;
+    }
+#endif
+#ifdef __cpp_sized_deallocation
+    ::operator delete(p, s);
+#else
+    ::operator delete(p);
+#endif
+}
+
 PYBIND11_NAMESPACE_BEGIN(initimpl)
 
 inline void no_nullptr(void *ptr) {
@@ -195,6 +261,88 @@ void construct(value_and_holder &v_h, Alias<Class> &&result, bool) {
     v_h.value_ptr() = new Alias<Class>(std::move(result));
 }
 
+// Return-by-value factories returning exactly the class (or alias) type: the returned prvalue
+// directly initializes the new heap instance (guaranteed copy elision as of C++17) rather than
+// being moved into it.  Everything else goes through the construct() overloads above.
+template <typename Class, typename Func, typename... Args>
+void construct_from_factory(std::true_type /*returns Cpp<Class>*/,
+                            value_and_holder &v_h,
+                            Func &func,
+                            bool need_alias,
+                            Args &&...args) {
+    if (Class::has_alias && need_alias) {
+        construct<Class>(v_h, func(std::forward<Args>(args)...), need_alias);
+    } else {
+        v_h.value_ptr() = new Cpp<Class>(func(std::forward<Args>(args)...));
+    }
+}
+template <typename Class, typename Func, typename... Args>
+void construct_from_factory(std::false_type,
+                            value_and_holder &v_h,
+                            Func &func,
+                            bool need_alias,
+                            Args &&...args) {
+    construct<Class>(v_h, func(std::forward<Args>(args)...), need_alias);
+}
+template <typename Class, typename Return, typename Func, typename... Args>
+void construct_from_factory(value_and_holder &v_h, Func &func, bool need_alias, Args &&...args) {
+    construct_from_factory<Class>(std::is_same<Return, Cpp<Class>>{},
+                                  v_h,
+                                  func,
+                                  need_alias,
+                                  std::forward<Args>(args)...);
+}
+
+// Storage for a placement factory: allocated as for `new Cpp<Class>`, so that the holder (or
+// dealloc) can later destroy the constructed instance as usual, and released again if the
+// factory throws before the instance is handed over.
+template <typename Class>
+class placement_storage {
+public:
+    placement_storage()
+        : ptr(call_operator_new<Cpp<Class>>(sizeof(Cpp<Class>), alignof(Cpp<Class>))) {}
+    ~placement_storage() {
+        if (ptr != nullptr) {
+            call_operator_delete(
+                static_cast<Cpp<Class> *>(ptr), sizeof(Cpp<Class>), alignof(Cpp<Class>));
+        }
+    }
+    placement_storage(const placement_storage &) = delete;
+    placement_storage &operator=(const placement_storage &) = delete;
+
+    void *get() const { return ptr; }
+    Cpp<Class> *release() {
+        auto *result = static_cast<Cpp<Class> *>(ptr);
+        ptr = nullptr;
+        return result;
+    }
+
+private:
+    void *ptr;
+};
+
+// Placement factory: the factory constructs the instance in uninitialized storage, which becomes
+// the instance's value as is.  If an alias is needed the alias is move-constructed from it, as
+// for a return-by-value factory.
+template <typename Class, typename Func, typename... Args>
+void construct_placement(value_and_holder &v_h, Func &func, bool need_alias, Args &&...args) {
+    using T = Cpp<Class>;
+    placement_storage<Class> storage;
+    func(storage.get(), std::forward<Args>(args)...);
+    if (Class::has_alias && need_alias) {
+        auto *ptr = static_cast<T *>(storage.get());
+        try {
+            construct_alias_from_cpp<Class>(is_alias_constructible<Class>{}, v_h, std::move(*ptr));
+        } catch (...) {
+            ptr->~T();
+            throw;
+        }
+        ptr->~T();
+        return;
+    }
+    v_h.value_ptr() = storage.release();
+}
+
 // Implementing class for py::init<...>()
 template <typename... Args>
 struct constructor {
@@ -300,8 +448,10 @@ struct factory<Func, void_type (*)(), Return(Args...)> {
             [func]
 #endif
             (value_and_holder &v_h, Args... args) {
-                construct<Class>(
-                    v_h, func(std::forward<Args>(args)...), Py_TYPE(v_h.inst) != v_h.type->type);
+                construct_from_factory<Class, Return>(v_h,
+                                                      func,
+                                                      Py_TYPE(v_h.inst) != v_h.type->type,
+                                                      std::forward<Args>(args)...);
             },
             is_new_style_constructor(),
             extra...);
@@ -351,7 +501,8 @@ struct factory<CFunc, AFunc, CReturn(CArgs...), AReturn(AArgs...)> {
                 if (Py_TYPE(v_h.inst) == v_h.type->type) {
                     // If the instance type equals the registered type we don't have inheritance,
                     // so don't need the alias and can construct using the class function:
-                    construct<Class>(v_h, class_func(std::forward<CArgs>(args)...), false);
+                    construct_from_factory<Class, CReturn>(
+                        v_h, class_func, false, std::forward<CArgs>(args)...);
                 } else {
                     construct<Class>(v_h, alias_func(std::forward<CArgs>(args)...), true);
                 }
@@ -361,6 +512,42 @@ struct factory<CFunc, AFunc, CReturn(CArgs...), AReturn(AArgs...)> {
     }
 };
 
+// Implementation class for py::init_placement(Func)
+template <typename Func, typename = function_signature_t<Func>>
+struct placement_factory;
+
+template <typename Func, typename Return, typename Storage, typename... Args>
+struct placement_factory<Func, Return(Storage, Args...)> {
+    static_assert(std::is_same<Storage, void *>::value,
+                  "pybind11::init_placement(): the first argument of the factory function must "
+                  "be the `void *` storage to construct the instance in");
+
+    remove_reference_t<Func> class_factory;
+
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    placement_factory(Func &&f) : class_factory(std::forward<Func>(f)) {}
+
+    template <typename Class, typename... Extra>
+    void execute(Class &cl, const Extra &...extra) && {
+#if defined(PYBIND11_CPP14)
+        cl.def(
+            "__init__",
+            [func = std::move(class_factory)]
+#else
+        auto &func = class_factory;
+        cl.def(
+            "__init__",
+            [func]
+#endif
+            (value_and_holder &v_h, Args... args) {
+                construct_placement<Class>(
+                    v_h, func, Py_TYPE(v_h.inst) != v_h.type->type, std::forward<Args>(args)...);
+            },
+            is_new_style_constructor(),
+            extra...);
+    }
+};
+
 /// Set just the C++ state. Same as `__init__`.
 template <typename Class, typename T>
 void setstate(value_and_holder &v_h, T &&result, bool need_alias) {
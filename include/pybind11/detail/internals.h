@@ -46,6 +46,12 @@
 static_assert(PY_VERSION_HEX < 0x030C0000 || PYBIND11_INTERNALS_VERSION >= 5,
               "pybind11 ABI version 5 is the minimum for Python 3.12+");
 
+#if defined(PYBIND11_RUNTIME)
+// Set by the pybind11::runtime target to the internals version the library was built with.
+static_assert(PYBIND11_RUNTIME == PYBIND11_INTERNALS_VERSION,
+              "pybind11::runtime was built for a different PYBIND11_INTERNALS_VERSION");
+#endif
+
 PYBIND11_NAMESPACE_BEGIN(PYBIND11_NAMESPACE)
 
 using ExceptionTranslator = void (*)(std::exception_ptr);
@@ -53,11 +59,13 @@ using ExceptionTranslator = void (*)(std::exception_ptr);
 PYBIND11_NAMESPACE_BEGIN(detail)
 
 constexpr const char *internals_function_record_capsule_name = "pybind11_function_record_capsule";
+// Capsule name of function records with `arg_names`, see `get_function_record_capsule_name()`
+constexpr const char *function_record_capsule_name_v2 = "pybind11_function_record_v2";
 
 // Forward declarations
-inline PyTypeObject *make_static_property_type();
-inline PyTypeObject *make_default_metaclass();
-inline PyObject *make_object_base_type(PyTypeObject *metaclass);
+PYBIND11_RUNTIME_INLINE PyTypeObject *make_static_property_type();
+PYBIND11_RUNTIME_INLINE PyTypeObject *make_default_metaclass();
+PYBIND11_RUNTIME_INLINE PyObject *make_object_base_type(PyTypeObject *metaclass);
 
 // The old Python Thread Local Storage (TLS) API is deprecated in Python 3.7 in favor of the new
 // Thread Specific Storage (TSS) API.
@@ -186,6 +194,12 @@ struct internals {
     PyTypeObject *static_property_type;
     PyTypeObject *default_metaclass;
     PyObject *instance_base;
+#if PYBIND11_INTERNALS_VERSION > 5
+    // Counts changes to the registered types, see `type_registry_changed()`. Never freed, so that
+    // its address identifies these internals for the lifetime of the process: caches filled
+    // before an interpreter restart (when embedding) cannot match the next counter.
+    std::size_t *type_registry_generation = new std::size_t(1);
+#endif
 #if defined(WITH_THREAD)
     // Unused if PYBIND11_SIMPLE_GIL_MANAGEMENT is defined:
     PYBIND11_TLS_KEY_INIT(tstate)
@@ -198,6 +212,7 @@ struct internals {
 #    if PYBIND11_INTERNALS_VERSION > 4
     // Note that we have to use a std::string to allocate memory to ensure a unique address
     // We want unique addresses since we use pointer equality to compare function records
+    // (no longer used by this version, see `get_function_record_capsule_name()`)
     std::string function_record_capsule_name = internals_function_record_capsule_name;
 #    endif
 
@@ -249,6 +264,26 @@ struct type_info {
     bool module_local : 1;
 };
 
+/// Number of live instances of a pybind11 type, and the combined C++ `sizeof` of the values they
+/// own
+struct instance_stats {
+    size_t count = 0;
+    size_t bytes = 0;
+};
+
+/// Live instance counts of all pybind11 types, kept while `py::track_live_instances()` is enabled
+struct instance_stats_registry {
+    bool enabled = false;
+    std::unordered_map<PyTypeObject *, instance_stats> types;
+};
+
+/// Recently converted `interned_str` values, each in the slot given by a hash of its UTF-8
+/// contents; a value hashing to an occupied slot replaces its previous occupant
+struct interned_str_cache {
+    static constexpr size_t slots = 1024;
+    PyObject *strings[slots] = {};
+};
+
 /// On MSVC, debug and release builds are not ABI-compatible!
 #if defined(_MSC_VER) && defined(_DEBUG)
 #    define PYBIND11_BUILD_TYPE "_debug"
@@ -319,10 +354,14 @@ struct type_info {
 
 /// Each module locally stores a pointer to the `internals` data. The data
 /// itself is shared among modules with the same `PYBIND11_INTERNALS_ID`.
-inline internals **&get_internals_pp() {
+#if defined(PYBIND11_RUNTIME_DECLARATIONS_ONLY)
+PYBIND11_RUNTIME_INLINE internals **&get_internals_pp();
+#else
+PYBIND11_RUNTIME_INLINE internals **&get_internals_pp() {
     static internals **internals_pp = nullptr;
     return internals_pp;
 }
+#endif
 
 // forward decl
 inline void translate_exception(std::exception_ptr);
@@ -464,7 +503,10 @@ inline internals **get_internals_pp_from_capsule(handle obj) {
 }
 
 /// Return a reference to the current `internals` data
-PYBIND11_NOINLINE internals &get_internals() {
+#if defined(PYBIND11_RUNTIME_DECLARATIONS_ONLY)
+PYBIND11_RUNTIME_INLINE internals &get_internals();
+#else
+PYBIND11_RUNTIME_NOINLINE internals &get_internals() {
     auto **&internals_pp = get_internals_pp();
     if (internals_pp && *internals_pp) {
         return **internals_pp;
@@ -534,6 +576,7 @@ PYBIND11_NOINLINE internals &get_internals() {
     }
     return **internals_pp;
 }
+#endif
 
 // the internals struct (above) is shared between all the modules. local_internals are only
 // for a single module. Any changes made to internals may require an update to
@@ -544,6 +587,12 @@ PYBIND11_NOINLINE internals &get_internals() {
 struct local_internals {
     type_map<type_info *> registered_types_cpp;
     std::forward_list<ExceptionTranslator> registered_exception_translators;
+    // Points to the registry in `internals.shared_data` used by `registered_instance_stats()`
+    instance_stats_registry *instance_stats = nullptr;
+    // Points to the table in `internals.shared_data` used by `get_interned_str_cache()`
+    interned_str_cache *interned_strings = nullptr;
+    // Points to the string in `internals.shared_data` used by `get_function_record_capsule_name()`
+    const char *function_record_capsule_name = nullptr;
 #if defined(WITH_THREAD) && PYBIND11_INTERNALS_VERSION == 4
 
     // For ABI compatibility, we can't store the loader_life_support TLS key in
@@ -591,6 +640,45 @@ inline local_internals &get_local_internals() {
     return *locals;
 }
 
+/// Records that a type was added to or removed from `internals.registered_types_cpp` or a
+/// module's local registry. Type lookup caches (see `get_type_info<T>()`) remember the counter
+/// value they were filled at and are refreshed when it changes. The counter is only part of the
+/// internals from version 6 on; modules built for older versions share the same registries
+/// without updating it, so the caches are disabled for those versions.
+inline void type_registry_changed() {
+#if PYBIND11_INTERNALS_VERSION > 5
+    ++*get_internals().type_registry_generation;
+#endif
+}
+
+/// Returns the live instance counts of all pybind11 types, shared by all modules. When enabled,
+/// they are maintained by `register_instance()` and `deregister_instance()`.
+inline instance_stats_registry &registered_instance_stats() {
+    auto &locals = get_local_internals();
+    if (!locals.instance_stats) {
+        auto &ptr = get_internals().shared_data["_instance_stats"];
+        if (!ptr) {
+            ptr = new instance_stats_registry();
+        }
+        locals.instance_stats = static_cast<instance_stats_registry *>(ptr);
+    }
+    return *locals.instance_stats;
+}
+
+/// Returns the cache of Python strings created by the `interned_str` caster, shared by all
+/// modules. Its references are deliberately never released.
+inline interned_str_cache &get_interned_str_cache() {
+    auto &locals = get_local_internals();
+    if (!locals.interned_strings) {
+        auto &ptr = get_internals().shared_data["_interned_str_cache"];
+        if (!ptr) {
+            ptr = new interned_str_cache();
+        }
+        locals.interned_strings = static_cast<interned_str_cache *>(ptr);
+    }
+    return *locals.interned_strings;
+}
+
 /// Constructs a std::string with the given arguments, stores it in `internals`, and returns its
 /// `c_str()`.  Such strings objects have a long storage duration -- the internal strings are only
 /// cleared when the program exits or after interpreter shutdown (when embedding), and so are
@@ -602,12 +690,20 @@ const char *c_str(Args &&...args) {
     return strings.front().c_str();
 }
 
+/// Returns the name of the capsules holding a `function_record`. Records are only used across
+/// modules whose capsule names have the same address, so that the name also identifies the layout
+/// of `function_record`. Modules that predate `function_record::arg_names` use the name stored in
+/// `internals` (or none at all with internals version 4); those with it share a separate string.
 inline const char *get_function_record_capsule_name() {
-#if PYBIND11_INTERNALS_VERSION > 4
-    return get_internals().function_record_capsule_name.c_str();
-#else
-    return nullptr;
-#endif
+    auto &locals = get_local_internals();
+    if (!locals.function_record_capsule_name) {
+        auto &ptr = get_internals().shared_data["_function_record_capsule_name"];
+        if (!ptr) {
+            ptr = new std::string(function_record_capsule_name_v2);
+        }
+        locals.function_record_capsule_name = static_cast<std::string *>(ptr)->c_str();
+    }
+    return locals.function_record_capsule_name;
 }
 
 // Determine whether or not the following capsule contains a pybind11 function record.
@@ -231,6 +231,59 @@ PYBIND11_NOINLINE detail::type_info *get_type_info(const std::type_index &tp,
     return nullptr;
 }
 
+/// Equivalent of `get_type_info(typeid(T))`. With internals version 6 or newer, the result
+/// (including a miss) is kept in a per-type static and only looked up again after the set of
+/// registered types has changed (see `type_registry_changed()`), so the steady-state cost is a
+/// comparison against the internals' generation counter.
+template <typename T>
+detail::type_info *get_type_info() {
+#if PYBIND11_INTERNALS_VERSION > 5
+    struct cache_entry {
+        detail::type_info *tinfo;
+        const std::size_t *counter;
+        std::size_t generation;
+    };
+    static cache_entry cache{nullptr, nullptr, 0};
+    const std::size_t *counter = get_internals().type_registry_generation;
+    if (cache.counter != counter || cache.generation != *counter) {
+        cache = {get_type_info(typeid(T)), counter, *counter};
+    }
+    return cache.tinfo;
+#else
+    return get_type_info(typeid(T));
+#endif
+}
+
+/// Type info lookup for the dynamic type of a polymorphic object, as reported by `typeid`.
+/// With internals version 6 or newer, results (including misses) are memoized per module by
+/// `std::type_info` address, which is cheap to hash unlike the mangled name used by
+/// `get_type_info`, and are dropped whenever the set of registered types changes.
+inline detail::type_info *get_polymorphic_type_info(const std::type_info &rtti) {
+#if PYBIND11_INTERNALS_VERSION > 5
+    struct cache_t {
+        std::unordered_map<const std::type_info *, detail::type_info *> types;
+        const std::size_t *counter = nullptr;
+        std::size_t generation = 0;
+    };
+    static auto *cache = new cache_t();
+    const std::size_t *counter = get_internals().type_registry_generation;
+    if (cache->counter != counter || cache->generation != *counter) {
+        cache->types.clear();
+        cache->counter = counter;
+        cache->generation = *counter;
+    }
+    auto it = cache->types.find(&rtti);
+    if (it != cache->types.end()) {
+        return it->second;
+    }
+    auto *tinfo = get_type_info(rtti);
+    cache->types.emplace(&rtti, tinfo);
+    return tinfo;
+#else
+    return get_type_info(rtti);
+#endif
+}
+
 PYBIND11_NOINLINE handle get_type_handle(const std::type_info &tp, bool throw_if_missing) {
     detail::type_info *type_info = get_type_info(tp, throw_if_missing);
     return handle(type_info ? ((PyObject *) type_info->type) : nullptr);
@@ -250,6 +303,11 @@ PYBIND11_NOINLINE handle find_registered_python_instance(void *src,
     return handle();
 }
 
+/// True for holder types that consist of nothing but the value pointer (e.g. `intrusive_ptr`):
+/// these are stored in the value pointer slot itself and take no holder space in the instance.
+template <typename H>
+struct holder_in_value_slot : std::false_type {};
+
 struct value_and_holder {
     instance *inst = nullptr;
     size_t index = 0u;
@@ -277,7 +335,7 @@ struct value_and_holder {
 
     template <typename H>
     H &holder() const {
-        return reinterpret_cast<H &>(vh[1]);
+        return reinterpret_cast<H &>(vh[holder_in_value_slot<H>::value ? 0 : 1]);
     }
     bool holder_constructed() const {
         return inst->simple_layout
@@ -493,7 +551,31 @@ inline PyThreadState *get_thread_state_unchecked() {
 
 // Forward declarations
 void keep_alive_impl(handle nurse, handle patient);
-inline PyObject *make_new_instance(PyTypeObject *type);
+PYBIND11_RUNTIME_INLINE PyObject *make_new_instance(PyTypeObject *type);
+
+struct conversion_route_hash {
+    size_t operator()(const std::pair<const void *, const PyTypeObject *> &v) const {
+        size_t value = std::hash<const void *>()(v.first);
+        value ^= std::hash<const void *>()(v.second) + 0x9e3779b9 + (value << 6) + (value >> 2);
+        return value;
+    }
+};
+
+/// Per-module record of which implicit conversion last succeeded for a given target converter
+/// list and Python source type (see `type_caster_generic::try_converters`). Entries are never
+/// invalidated, as a stale hint is harmless, but the table is bounded by
+/// `max_conversion_routes`.
+constexpr size_t max_conversion_routes = 256;
+
+inline std::unordered_map<std::pair<const void *, const PyTypeObject *>,
+                          size_t,
+                          conversion_route_hash> &
+conversion_routes() {
+    static auto *routes = new std::unordered_map<std::pair<const void *, const PyTypeObject *>,
+                                                 size_t,
+                                                 conversion_route_hash>();
+    return *routes;
+}
 
 class type_caster_generic {
 public:
@@ -503,6 +585,9 @@ public:
     explicit type_caster_generic(const type_info *typeinfo)
         : typeinfo(typeinfo), cpptype(typeinfo ? typeinfo->cpptype : nullptr) {}
 
+    type_caster_generic(const type_info *typeinfo, const std::type_info &type_info)
+        : typeinfo(typeinfo), cpptype(&type_info) {}
+
     bool load(handle src, bool convert) { return load_impl<type_caster_generic>(src, convert); }
 
     PYBIND11_NOINLINE static handle cast(const void *_src,
@@ -597,6 +682,20 @@ public:
         return inst.release();
     }
 
+    /// Wraps a new owning instance of `tinfo` around a move (or copy) of `src`. Unlike `cast()`,
+    /// there is no registered-instance lookup: the caller guarantees that `src` is of exactly
+    /// the type `tinfo` and is about to be discarded, so it cannot have a Python instance yet.
+    PYBIND11_NOINLINE static handle cast_moved(void *src,
+                                               const detail::type_info *tinfo,
+                                               void *(*move_constructor)(const void *)) {
+        auto inst = reinterpret_steal<object>(make_new_instance(tinfo->type));
+        auto *wrapper = reinterpret_cast<instance *>(inst.ptr());
+        values_and_holders(wrapper).begin()->value_ptr() = move_constructor(src);
+        wrapper->owned = true;
+        tinfo->init_instance(wrapper, nullptr);
+        return inst.release();
+    }
+
     // Base methods for generic caster; there are overridden in copyable_holder_caster
     void load_value(value_and_holder &&v_h) {
         auto *&vptr = v_h.value_ptr();
@@ -630,14 +729,44 @@ public:
         return false;
     }
     bool try_direct_conversions(handle src) {
-        for (auto &converter : *typeinfo->direct_conversions) {
-            if (converter(src.ptr(), value)) {
+        return try_converters(*typeinfo->direct_conversions,
+                              Py_TYPE(src.ptr()),
+                              [&](bool (*converter)(PyObject *, void *&)) {
+                                  return converter(src.ptr(), value);
+                              });
+    }
+    void check_holder_compat() {}
+
+    /// Calls `attempt` with each of `converters` until one succeeds. The converter that last
+    /// succeeded for a given (converter list, Python type) pair is tried first; this is only a
+    /// hint, so it is fine for it to be stale or to fail.
+    template <typename Converter, typename Attempt>
+    static bool try_converters(const std::vector<Converter> &converters,
+                               PyTypeObject *srctype,
+                               Attempt &&attempt) {
+        if (converters.size() <= 1) {
+            return !converters.empty() && attempt(converters.front());
+        }
+        auto &routes = conversion_routes();
+        const std::pair<const void *, const PyTypeObject *> key{&converters, srctype};
+        auto it = routes.find(key);
+        const size_t hint = it != routes.end() ? it->second : converters.size();
+        if (hint < converters.size() && attempt(converters[hint])) {
+            return true;
+        }
+        for (size_t i = 0; i < converters.size(); ++i) {
+            if (i != hint && attempt(converters[i])) {
+                // Source types can be created without bound (e.g. by class factories), so start
+                // over rather than growing indefinitely
+                if (it == routes.end() && routes.size() >= max_conversion_routes) {
+                    routes.clear();
+                }
+                routes[key] = i;
                 return true;
             }
         }
         return false;
     }
-    void check_holder_compat() {}
 
     PYBIND11_NOINLINE static void *local_load(PyObject *src, const type_info *ti) {
         auto caster = type_caster_generic(ti);
@@ -733,12 +862,18 @@ public:
 
         // Perform an implicit conversion
         if (convert) {
-            for (const auto &converter : typeinfo->implicit_conversions) {
-                auto temp = reinterpret_steal<object>(converter(src.ptr(), typeinfo->type));
-                if (load_impl<ThisT>(temp, false)) {
-                    loader_life_support::add_patient(temp);
-                    return true;
-                }
+            if (try_converters(typeinfo->implicit_conversions,
+                               srctype,
+                               [&](PyObject *(*converter)(PyObject *, PyTypeObject *)) {
+                                   auto temp = reinterpret_steal<object>(
+                                       converter(src.ptr(), typeinfo->type));
+                                   if (load_impl<ThisT>(temp, false)) {
+                                       loader_life_support::add_patient(temp);
+                                       return true;
+                                   }
+                                   return false;
+                               })) {
+                return true;
             }
             if (this_.try_direct_conversions(src)) {
                 return true;
@@ -1056,6 +1191,13 @@ struct polymorphic_type_hook_base<itype, detail::enable_if_t<std::is_polymorphic
 template <typename itype, typename SFINAE = void>
 struct polymorphic_type_hook : public polymorphic_type_hook_base<itype> {};
 
+// sizeof_hook<T>::owned_bytes(const T &value) returns the heap memory owned by `value` (e.g. the
+// buffer of a container member), which `sys.getsizeof()` then adds to the size of Python
+// instances that own a T. Without a specialization, only the instance itself and sizeof(T)
+// are reported.
+template <typename T, typename SFINAE = void>
+struct sizeof_hook {};
+
 PYBIND11_NAMESPACE_BEGIN(detail)
 
 /// Generic type caster for objects stored on the heap
@@ -1066,7 +1208,7 @@ class type_caster_base : public type_caster_generic {
 public:
     static constexpr auto name = const_name<type>();
 
-    type_caster_base() : type_caster_base(typeid(type)) {}
+    type_caster_base() : type_caster_generic(get_type_info<type>(), typeid(type)) {}
     explicit type_caster_base(const std::type_info &info) : type_caster_generic(info) {}
 
     static handle cast(const itype &src, return_value_policy policy, handle parent) {
@@ -1097,12 +1239,15 @@ public:
             // except via a user-provided specialization of polymorphic_type_hook,
             // and the user has promised that no this-pointer adjustment is
             // required in that case, so it's OK to use static_cast.
-            if (const auto *tpi = get_type_info(*instance_type)) {
+            if (const auto *tpi = get_polymorphic_type_info(*instance_type)) {
                 return {vsrc, tpi};
             }
         }
         // Otherwise we have either a nullptr, an `itype` pointer, or an unknown derived pointer,
         // so don't do a cast
+        if (const auto *tpi = get_type_info<itype>()) {
+            return {src, tpi};
+        }
         return type_caster_generic::src_and_type(src, cast_type, instance_type);
     }
 
@@ -1116,6 +1261,24 @@ public:
                                          make_move_constructor(src));
     }
 
+    /// Type info for casting many values of exactly `itype` with `cast_moved()`, or nullptr if
+    /// that does not apply: the type is not registered, not movable or copyable, or has a custom
+    /// `polymorphic_type_hook` that may map a value to another type.
+    static const detail::type_info *moved_type_info() {
+        if (!std::is_base_of<polymorphic_type_hook_base<itype>,
+                             polymorphic_type_hook<itype>>::value
+            || make_move_constructor((const itype *) nullptr) == nullptr) {
+            return nullptr;
+        }
+        return get_type_info(typeid(itype));
+    }
+
+    /// Casts a value that is moved out of a container being returned by value, with the type
+    /// info obtained once from `moved_type_info()`.
+    static handle cast_moved(itype &&src, const detail::type_info *tinfo) {
+        return type_caster_generic::cast_moved(&src, tinfo, make_move_constructor(&src));
+    }
+
     static handle cast_holder(const itype *src, const void *holder) {
         auto st = src_and_type(src);
         return type_caster_generic::cast(st.first,
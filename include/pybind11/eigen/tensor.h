@@ -205,6 +205,8 @@ struct type_caster<Type, typename eigen_tensor_helper<Type>::ValidType> {
         auto data_pointer = const_cast<typename Type::Scalar *>(arr.data());
 #endif
 
+        // Eigen copies plain memory into our own `value`, and `arr` keeps the source alive
+        copy_gil_release release(static_cast<size_t>(arr.nbytes()));
         if (is_tensor_aligned(arr.data())) {
             value = Eigen::TensorMap<const Type, Eigen::Aligned>(data_pointer, shape);
         } else {
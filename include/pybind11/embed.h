@@ -256,6 +256,10 @@ inline void finalize_interpreter() {
     // avoid undefined behaviors when initializing another interpreter
     detail::get_local_internals().registered_types_cpp.clear();
     detail::get_local_internals().registered_exception_translators.clear();
+    auto &locals = detail::get_local_internals();
+    locals.instance_stats = nullptr;
+    locals.interned_strings = nullptr;
+    locals.function_record_capsule_name = nullptr;
 
     Py_Finalize();
 
@@ -11,6 +11,25 @@
 
 #include "detail/common.h"
 
+#include <cstring>
+#include <memory>
+
+#if !defined(PYBIND11_COPY_RELEASE_GIL_THRESHOLD)
+// Casters copying at least this many bytes of plain memory release the GIL meanwhile (0: never)
+#    define PYBIND11_COPY_RELEASE_GIL_THRESHOLD (1 << 20)
+#endif
+
+#if !defined(PYBIND11_COPY_THREADS)
+// Maximum number of threads used for such copies (each gets at least the threshold's worth)
+#    define PYBIND11_COPY_THREADS 1
+#endif
+
+#if PYBIND11_COPY_THREADS > 1
+#    include <algorithm>
+#    include <thread>
+#    include <vector>
+#endif
+
 #if defined(WITH_THREAD) && !defined(PYBIND11_SIMPLE_GIL_MANAGEMENT)
 #    include "detail/internals.h"
 #endif
@@ -236,4 +255,57 @@ public:
 
 #endif // WITH_THREAD
 
+PYBIND11_NAMESPACE_BEGIN(detail)
+
+/// Releases the GIL for its lifetime if `nbytes` reaches PYBIND11_COPY_RELEASE_GIL_THRESHOLD.
+/// Only for copies that touch no Python objects and whose destination no other thread can reach
+/// yet (e.g. a caster's own value), with the source kept alive by a held reference.
+class copy_gil_release {
+public:
+    explicit copy_gil_release(size_t nbytes) {
+        if (PYBIND11_COPY_RELEASE_GIL_THRESHOLD != 0
+            && nbytes >= (size_t) PYBIND11_COPY_RELEASE_GIL_THRESHOLD) {
+            release.reset(new gil_scoped_release());
+        }
+    }
+
+private:
+    std::unique_ptr<gil_scoped_release> release;
+};
+
+/// `std::memcpy` with the GIL released for large copies (see `copy_gil_release`), split across
+/// up to PYBIND11_COPY_THREADS threads.
+inline void copy_bytes(void *dst, const void *src, size_t nbytes) {
+    copy_gil_release release(nbytes);
+#if PYBIND11_COPY_THREADS > 1
+    constexpr size_t min_part = PYBIND11_COPY_RELEASE_GIL_THRESHOLD > 0
+                                    ? (size_t) PYBIND11_COPY_RELEASE_GIL_THRESHOLD
+                                    : (size_t) 1 << 20;
+    size_t parts = (std::min)((size_t) PYBIND11_COPY_THREADS, nbytes / min_part);
+    if (parts > 1) {
+        auto *d = static_cast<char *>(dst);
+        const auto *s = static_cast<const char *>(src);
+        size_t part = nbytes / parts;
+        std::vector<std::thread> workers;
+        size_t done = nbytes; // bytes from here on are copied by the workers
+        try {
+            for (size_t i = parts - 1; i > 0; --i) {
+                size_t offset = i * part, len = done - offset;
+                workers.emplace_back([=] { std::memcpy(d + offset, s + offset, len); });
+                done = offset;
+            }
+        } catch (...) { // NOLINT(bugprone-empty-catch): could not start a thread; copy the rest
+        }
+        std::memcpy(d, s, done);
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        return;
+    }
+#endif
+    std::memcpy(dst, src, nbytes);
+}
+
+PYBIND11_NAMESPACE_END(detail)
+
 PYBIND11_NAMESPACE_END(PYBIND11_NAMESPACE)
@@ -14,10 +14,13 @@
 
 #include <algorithm>
 #include <array>
+#include <bitset>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <numeric>
 #include <sstream>
 #include <string>
@@ -83,6 +86,21 @@ struct PyVoidScalarObject_Proxy {
     PyObject *base;
 };
 
+// NEP 49 (numpy >= 1.22) data memory handler
+struct PyDataMemAllocator_Proxy {
+    void *ctx;
+    void *(*malloc)(void *ctx, size_t size);
+    void *(*calloc)(void *ctx, size_t nelem, size_t elsize);
+    void *(*realloc)(void *ctx, void *ptr, size_t new_size);
+    void (*free)(void *ctx, void *ptr, size_t size);
+};
+
+struct PyDataMem_Handler_Proxy {
+    char name[127];
+    std::uint8_t version;
+    PyDataMemAllocator_Proxy allocator;
+};
+
 struct numpy_type_info {
     PyObject *dtype_ptr;
     std::string format_str;
@@ -238,6 +256,9 @@ struct npy_api {
     PyObject *(*PyArray_Resize_)(PyObject *, PyArray_Dims *, int, int);
     PyObject *(*PyArray_Newshape_)(PyObject *, PyArray_Dims *, int);
     PyObject *(*PyArray_View_)(PyObject *, PyObject *, PyObject *);
+    // NEP 49 memory handlers; nullptr with numpy < 1.22
+    PyObject *(*PyDataMem_SetHandler_)(PyObject *);
+    PyObject *(*PyDataMem_GetHandler_)();
 
 private:
     enum functions {
@@ -259,7 +280,9 @@ private:
         API_PyArray_DescrConverter = 174,
         API_PyArray_EquivTypes = 182,
         API_PyArray_GetArrayParamsFromObject = 278,
-        API_PyArray_SetBaseObject = 282
+        API_PyArray_SetBaseObject = 282,
+        API_PyDataMem_SetHandler = 304,
+        API_PyDataMem_GetHandler = 305
     };
 
     static npy_api lookup() {
@@ -290,6 +313,13 @@ private:
         DECL_NPY_API(PyArray_EquivTypes);
         DECL_NPY_API(PyArray_GetArrayParamsFromObject);
         DECL_NPY_API(PyArray_SetBaseObject);
+        if (api.PyArray_GetNDArrayCFeatureVersion_() >= 0xf) {
+            DECL_NPY_API(PyDataMem_SetHandler);
+            DECL_NPY_API(PyDataMem_GetHandler);
+        } else {
+            api.PyDataMem_SetHandler_ = nullptr;
+            api.PyDataMem_GetHandler_ = nullptr;
+        }
 
 #undef DECL_NPY_API
         return api;
@@ -1145,10 +1175,12 @@ public:
 
     static bool check_(handle h) {
         const auto &api = detail::npy_api::get();
-        return api.PyArray_Check_(h.ptr())
-               && api.PyArray_EquivTypes_(detail::array_proxy(h.ptr())->descr,
-                                          dtype::of<T>().ptr())
-               && detail::check_flags(h.ptr(), ExtraFlags & (array::c_style | array::f_style));
+        if (!api.PyArray_Check_(h.ptr())
+            || !detail::check_flags(h.ptr(), ExtraFlags & (array::c_style | array::f_style))) {
+            return false;
+        }
+        PyObject *descr = detail::array_proxy(h.ptr())->descr;
+        return descr == cached_dtype() || api.PyArray_EquivTypes_(descr, cached_dtype());
     }
 
 protected:
@@ -1158,16 +1190,160 @@ protected:
             PyErr_SetString(PyExc_ValueError, "cannot create a pybind11::array_t from a nullptr");
             return nullptr;
         }
-        return detail::npy_api::get().PyArray_FromAny_(ptr,
-                                                       dtype::of<T>().release().ptr(),
-                                                       0,
-                                                       0,
-                                                       detail::npy_api::NPY_ARRAY_ENSUREARRAY_
-                                                           | ExtraFlags,
-                                                       nullptr);
+        PyObject *descr = cached_dtype();
+        Py_INCREF(descr); // stolen by PyArray_FromAny
+        return detail::npy_api::get().PyArray_FromAny_(
+            ptr, descr, 0, 0, detail::npy_api::NPY_ARRAY_ENSUREARRAY_ | ExtraFlags, nullptr);
+    }
+
+    /// The descriptor of `T` never changes, so keep the one `dtype::of<T>()` returned first
+    /// (leaked, like `npy_api`) rather than creating a new reference on every check.
+    static PyObject *cached_dtype() {
+        static PyObject *descr = dtype::of<T>().release().ptr();
+        return descr;
     }
 };
 
+PYBIND11_NAMESPACE_BEGIN(detail)
+
+/// Implements the NEP 49 allocator functions on top of a byte allocator. NumPy passes the block
+/// size to `free` but not to `realloc`, so each block starts with a header recording its size;
+/// the header is a cache line long so the data stays as aligned as the allocator's blocks.
+template <typename Alloc>
+struct numpy_mem_handler_impl {
+    using byte_alloc =
+        typename std::allocator_traits<Alloc>::template rebind_alloc<unsigned char>;
+    using traits = std::allocator_traits<byte_alloc>;
+    static constexpr size_t header = 64;
+
+    PyDataMem_Handler_Proxy handler;
+    byte_alloc alloc;
+
+    numpy_mem_handler_impl(const char *name, const Alloc &a) : handler(), alloc(a) {
+        std::strncpy(handler.name, name, sizeof(handler.name) - 1);
+        handler.version = 1;
+        handler.allocator = {this, &malloc_, &calloc_, &realloc_, &free_};
+    }
+
+    static size_t &block_size(void *ptr) {
+        return *reinterpret_cast<size_t *>(static_cast<unsigned char *>(ptr) - header);
+    }
+
+    static void *malloc_(void *ctx, size_t size) {
+        auto *self = static_cast<numpy_mem_handler_impl *>(ctx);
+        if (size > std::numeric_limits<size_t>::max() - header) {
+            return nullptr;
+        }
+        try {
+            unsigned char *block = traits::allocate(self->alloc, size + header);
+            *reinterpret_cast<size_t *>(block) = size;
+            return block + header;
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    static void *calloc_(void *ctx, size_t nelem, size_t elsize) {
+        if (elsize != 0 && nelem > std::numeric_limits<size_t>::max() / elsize) {
+            return nullptr;
+        }
+        void *ptr = malloc_(ctx, nelem * elsize);
+        if (ptr != nullptr) {
+            std::memset(ptr, 0, nelem * elsize);
+        }
+        return ptr;
+    }
+
+    static void *realloc_(void *ctx, void *ptr, size_t new_size) {
+        if (ptr == nullptr) {
+            return malloc_(ctx, new_size);
+        }
+        void *result = malloc_(ctx, new_size);
+        if (result != nullptr) {
+            size_t old_size = block_size(ptr);
+            std::memcpy(result, ptr, (std::min)(old_size, new_size));
+            free_(ctx, ptr, old_size);
+        }
+        return result;
+    }
+
+    static void free_(void *ctx, void *ptr, size_t) {
+        if (ptr == nullptr) {
+            return;
+        }
+        auto *self = static_cast<numpy_mem_handler_impl *>(ctx);
+        size_t size = block_size(ptr);
+        traits::deallocate(self->alloc, static_cast<unsigned char *>(ptr) - header, size + header);
+    }
+};
+
+inline npy_api &npy_api_with_mem_handlers() {
+    auto &api = npy_api::get();
+    if (api.PyDataMem_SetHandler_ == nullptr) {
+        pybind11_fail("NumPy memory handlers require numpy >= 1.22");
+    }
+    return api;
+}
+
+PYBIND11_NAMESPACE_END(detail)
+
+/** \rst
+    Creates a NumPy data memory handler (NEP 49, numpy >= 1.22) that allocates array data with a
+    copy of the C++ allocator ``alloc``. ``Alloc`` is rebound to ``unsigned char``; it may be
+    stateful (e.g. an arena or a NUMA-local resource) and is destroyed together with the handler,
+    once the last array allocated through it is gone. Install the returned handler with
+    ``set_numpy_mem_handler()`` or ``numpy_allocator_scope``.
+\endrst */
+template <typename Alloc = std::allocator<unsigned char>>
+capsule make_numpy_mem_handler(const char *name, const Alloc &alloc = Alloc()) {
+    auto *impl = new detail::numpy_mem_handler_impl<Alloc>(name, alloc);
+    return capsule(&impl->handler, "mem_handler", [](void *ptr) {
+        auto *handler = static_cast<detail::PyDataMem_Handler_Proxy *>(ptr);
+        delete static_cast<detail::numpy_mem_handler_impl<Alloc> *>(handler->allocator.ctx);
+    });
+}
+
+/// Returns the NumPy memory handler used for new arrays in the current context.
+inline object get_numpy_mem_handler() {
+    auto *handler = detail::npy_api_with_mem_handlers().PyDataMem_GetHandler_();
+    if (handler == nullptr) {
+        throw error_already_set();
+    }
+    return reinterpret_steal<object>(handler);
+}
+
+/// Installs `handler` for new arrays and returns the previous one. NumPy keeps the handler in a
+/// context variable, so this applies to the current thread (or asyncio task) and to contexts
+/// copied from it afterwards.
+inline object set_numpy_mem_handler(handle handler) {
+    auto *previous = detail::npy_api_with_mem_handlers().PyDataMem_SetHandler_(handler.ptr());
+    if (previous == nullptr) {
+        throw error_already_set();
+    }
+    return reinterpret_steal<object>(previous);
+}
+
+/// RAII guard that installs a NumPy memory handler and restores the previous one on exit.
+class numpy_allocator_scope {
+public:
+    explicit numpy_allocator_scope(handle handler)
+        : m_previous(set_numpy_mem_handler(handler)) {}
+
+    numpy_allocator_scope(const numpy_allocator_scope &) = delete;
+    numpy_allocator_scope &operator=(const numpy_allocator_scope &) = delete;
+
+    ~numpy_allocator_scope() {
+        auto *handler = detail::npy_api::get().PyDataMem_SetHandler_(m_previous.ptr());
+        if (handler == nullptr) {
+            PyErr_WriteUnraisable(m_previous.ptr());
+        }
+        Py_XDECREF(handler);
+    }
+
+private:
+    object m_previous;
+};
+
 template <typename T>
 struct format_descriptor<T, detail::enable_if_t<detail::is_pod_struct<T>::value>> {
     static std::string format() {
@@ -1207,7 +1383,13 @@ struct pyobject_caster<array_t<T, ExtraFlags>> {
     using type = array_t<T, ExtraFlags>;
 
     bool load(handle src, bool convert) {
-        if (!convert && !type::check_(src)) {
+        if (type::check_(src)) {
+            // Exact ndarrays of the right dtype and layout are what `ensure` would return anyway
+            if (Py_TYPE(src.ptr()) == npy_api::get().PyArray_Type_) {
+                value = reinterpret_borrow<type>(src);
+                return true;
+            }
+        } else if (!convert) {
             return false;
         }
         value = type::ensure(src);
@@ -1995,4 +2177,224 @@ Helper vectorize(Return (Class::*f)(Args...) const) {
     return Helper(std::mem_fn(f));
 }
 
+/// Return value wrapper created by `as_ndarray()`.
+template <typename Vector>
+struct ndarray_result {
+    Vector value;
+};
+
+/** \rst
+    Wraps a ``std::vector<T>`` or a rectangular ``std::vector<std::vector<T>>`` of arithmetic
+    ``T`` so that returning it produces a single 1-D or 2-D ``numpy.ndarray`` rather than a
+    (nested) list. Rows of different lengths raise ``ValueError``.
+\endrst */
+template <typename Vector>
+ndarray_result<detail::remove_cvref_t<Vector>> as_ndarray(Vector &&vector) {
+    return {std::forward<Vector>(vector)};
+}
+
+PYBIND11_NAMESPACE_BEGIN(detail)
+
+template <typename T, typename Alloc>
+struct type_caster<ndarray_result<std::vector<T, Alloc>>,
+                   enable_if_t<std::is_arithmetic<T>::value>> {
+    static handle
+    cast(const ndarray_result<std::vector<T, Alloc>> &src, return_value_policy, handle) {
+        array_t<T> result(static_cast<ssize_t>(src.value.size()));
+        std::copy(src.value.begin(), src.value.end(), result.mutable_data());
+        return result.release();
+    }
+
+    static constexpr auto name = handle_type_name<array_t<T>>::name;
+};
+
+template <typename T, typename RowAlloc, typename Alloc>
+struct type_caster<ndarray_result<std::vector<std::vector<T, RowAlloc>, Alloc>>,
+                   enable_if_t<std::is_arithmetic<T>::value>> {
+    static handle cast(const ndarray_result<std::vector<std::vector<T, RowAlloc>, Alloc>> &src,
+                       return_value_policy,
+                       handle) {
+        const auto &rows = src.value;
+        const size_t cols = rows.empty() ? 0 : rows.front().size();
+        for (const auto &row : rows) {
+            if (row.size() != cols) {
+                throw value_error("as_ndarray(): nested vector rows have different lengths");
+            }
+        }
+        array_t<T> result({static_cast<ssize_t>(rows.size()), static_cast<ssize_t>(cols)});
+        T *out = result.mutable_data();
+        for (const auto &row : rows) {
+            out = std::copy(row.begin(), row.end(), out);
+        }
+        return result.release();
+    }
+
+    static constexpr auto name = handle_type_name<array_t<T>>::name;
+};
+
+PYBIND11_NAMESPACE_BEGIN(bits)
+
+inline bool little_endian() {
+    const uint16_t one = 1;
+    unsigned char first;
+    std::memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+constexpr uint64_t byte_lanes(unsigned char b) { return 0x0101010101010101ULL * b; }
+
+/// Packs 8 bytes (any nonzero byte is true) into one byte, first byte in the top bit.
+inline unsigned char pack8(const unsigned char *src) {
+    uint64_t x;
+    std::memcpy(&x, src, 8);
+    // Turn every nonzero lane into 0x01, then gather the lanes with a single multiply.
+    x = ((((x & byte_lanes(0x7f)) + byte_lanes(0x7f)) | x) >> 7) & byte_lanes(1);
+    return static_cast<unsigned char>((x * 0x8040201008040201ULL) >> 56);
+}
+
+/// Inverse of pack8(): spreads the bits of `b` (top bit first) over 8 bytes of 0/1.
+inline void unpack8(unsigned char b, unsigned char *dst) {
+    uint64_t x = (byte_lanes(b) & 0x0102040810204080ULL);
+    x = ((x + byte_lanes(0x7f)) >> 7) & byte_lanes(1);
+    std::memcpy(dst, &x, 8);
+}
+
+PYBIND11_NAMESPACE_END(bits)
+
+PYBIND11_NAMESPACE_END(detail)
+
+/** \rst
+    Packs ``count`` booleans into ``(count + 7) / 8`` bytes in the layout of
+    ``numpy.packbits``: element 0 is the most significant bit of byte 0 and the unused low bits
+    of the last byte are zero. Works 8 elements at a time.
+\endrst */
+inline void pack_bits(const bool *src, size_t count, uint8_t *dst) {
+    const auto *in = reinterpret_cast<const unsigned char *>(src);
+    size_t i = 0;
+    if (detail::bits::little_endian()) {
+        for (; i + 8 <= count; i += 8) {
+            *dst++ = detail::bits::pack8(in + i);
+        }
+    }
+    for (; i < count; i += 8) {
+        unsigned char b = 0;
+        for (size_t j = 0; j < 8; ++j) {
+            b = static_cast<unsigned char>(b << 1);
+            if (i + j < count && in[i + j] != 0) {
+                b |= 1;
+            }
+        }
+        *dst++ = b;
+    }
+}
+
+/// Inverse of `pack_bits()`: expands the first ``count`` bits of ``src`` into booleans.
+inline void unpack_bits(const uint8_t *src, size_t count, bool *dst) {
+    auto *out = reinterpret_cast<unsigned char *>(dst);
+    size_t i = 0;
+    if (detail::bits::little_endian()) {
+        for (; i + 8 <= count; i += 8) {
+            detail::bits::unpack8(*src++, out + i);
+        }
+    }
+    for (; i < count; i += 8, ++src) {
+        for (size_t j = 0; j < 8 && i + j < count; ++j) {
+            out[i + j] = static_cast<unsigned char>((*src >> (7 - j)) & 1);
+        }
+    }
+}
+
+PYBIND11_NAMESPACE_BEGIN(detail)
+
+/// `std::bitset<N>` <-> 1-D ``numpy.bool_`` array of length N. Arguments may also be given as
+/// ``numpy.packbits`` output (``uint8``, ``(N + 7) / 8`` bytes) or, with implicit conversion,
+/// as any sequence of N booleans.
+template <size_t N>
+struct type_caster<std::bitset<N>> {
+public:
+    bool load(handle src, bool convert) {
+        if (PyObject_CheckBuffer(src.ptr())) {
+            buffer_view view;
+            if (PyObject_GetBuffer(src.ptr(), view.view(), PyBUF_STRIDES | PyBUF_FORMAT) != 0) {
+                PyErr_Clear();
+            } else if (view.ndim() == 1) {
+                return load_buffer(view);
+            }
+        }
+        if (!convert || !isinstance<sequence>(src) || isinstance<str>(src)) {
+            return false;
+        }
+        auto seq = reinterpret_borrow<sequence>(src);
+        if (seq.size() != N) {
+            return false;
+        }
+        value.reset();
+        size_t i = 0;
+        for (auto item : seq) {
+            make_caster<bool> conv;
+            if (!conv.load(item, convert)) {
+                return false;
+            }
+            value[i++] = cast_op<bool>(conv);
+        }
+        return true;
+    }
+
+    static handle cast(const std::bitset<N> &src, return_value_policy, handle) {
+        array_t<bool> result(std::vector<ssize_t>{static_cast<ssize_t>(N)});
+        auto *out = reinterpret_cast<unsigned char *>(result.mutable_data());
+        for (size_t i = 0; i < N; ++i) {
+            out[i] = src[i] ? 1 : 0;
+        }
+        return result.release();
+    }
+
+    PYBIND11_TYPE_CASTER(std::bitset<N>,
+                         const_name("numpy.ndarray[numpy.bool_[") + const_name<N>()
+                             + const_name("]]"));
+
+private:
+    static bool is_format(const char *format, char c) {
+        if (*format == '@' || *format == '=' || *format == '<' || *format == '>') {
+            ++format;
+        }
+        return format[0] == c && format[1] == '\0';
+    }
+
+    bool load_buffer(const buffer_view &view) {
+        const auto *data = static_cast<const unsigned char *>(view.ptr());
+        const ssize_t stride = view.strides(0);
+        value.reset();
+        if (is_format(view.format(), '?') && view.shape(0) == static_cast<ssize_t>(N)) {
+            size_t i = 0;
+            if (stride == 1 && bits::little_endian()) {
+                for (; i + 8 <= N; i += 8) {
+                    set_byte(i, bits::pack8(data + i));
+                }
+            }
+            for (; i < N; ++i) {
+                value[i] = data[static_cast<ssize_t>(i) * stride] != 0;
+            }
+            return true;
+        }
+        if (is_format(view.format(), 'B') && view.shape(0) == static_cast<ssize_t>((N + 7) / 8)) {
+            for (size_t i = 0; i < N; i += 8) {
+                set_byte(i, data[static_cast<ssize_t>(i / 8) * stride]);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void set_byte(size_t first, unsigned char b) {
+        for (size_t j = 0; b != 0 && j < 8; ++j, b = static_cast<unsigned char>(b << 1)) {
+            if ((b & 0x80) != 0 && first + j < N) {
+                value.set(first + j);
+            }
+        }
+    }
+};
+
+PYBIND11_NAMESPACE_END(detail)
+
 PYBIND11_NAMESPACE_END(PYBIND11_NAMESPACE)
@@ -16,6 +16,7 @@
 #include "gil.h"
 #include "options.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
@@ -160,8 +161,10 @@ protected:
         = std::unique_ptr<detail::function_record, InitializingFunctionRecordDeleter>;
 
     /// Space optimization: don't inline this frequently instantiated fragment
-    PYBIND11_NOINLINE unique_function_record make_function_record() {
-        return unique_function_record(new detail::function_record());
+    PYBIND11_NOINLINE unique_function_record make_function_record(size_t n_arg_records) {
+        auto unique_rec = unique_function_record(new detail::function_record());
+        unique_rec->args.reserve(n_arg_records);
+        return unique_rec;
     }
 
     /// Special internal constructor for functors, lambda functions, etc.
@@ -175,7 +178,11 @@ protected:
         /* Store the function including any extra state it might have (e.g. a lambda capture
          * object) */
         // The unique_ptr makes sure nothing is leaked in case of an exception.
-        auto unique_rec = make_function_record();
+        // Room is reserved for one argument record per annotation, plus `self` for methods.
+        auto unique_rec = make_function_record(
+            constexpr_sum(is_keyword<Extra>::value...)
+            + (any_of<is_keyword<Extra>...>::value
+               && any_of<std::is_same<is_method, Extra>...>::value));
         auto *rec = unique_rec.get();
 
         /* Store the capture object directly in the function record if there is enough space */
@@ -332,6 +339,14 @@ protected:
             strings.push_back(t);
             return t;
         }
+        char *allocate(size_t size) {
+            auto *t = static_cast<char *>(std::malloc(size));
+            if (!t) {
+                throw std::bad_alloc();
+            }
+            strings.push_back(t);
+            return t;
+        }
         void release() { strings.clear(); }
 
     private:
@@ -352,24 +367,20 @@ protected:
         // Keep track of strdup'ed strings, and clean them up as long as the function's capsule
         // has not taken ownership yet (when `unique_rec.release()` is called).
         // Note: This cannot easily be fixed by a `unique_ptr` with custom deleter, because the
-        // strings are only referenced before strdup'ing. So only *after* the following block could
-        // `destruct` safely be called, but even then, `repr` could still throw in the middle of
-        // copying all strings.
+        // strings are only referenced before strdup'ing. So only *after* the strings have been
+        // copied could `destruct` safely be called.
         strdup_guard guarded_strdup;
 
-        /* Create copies of all referenced C-style strings */
-        rec->name = guarded_strdup(rec->name ? rec->name : "");
-        if (rec->doc) {
-            rec->doc = guarded_strdup(rec->doc);
+        /* Until the strings are copied below, the record refers to the caller's strings */
+        if (!rec->name) {
+            rec->name = const_cast<char *>("");
         }
+        std::vector<std::string> value_reprs;
+        value_reprs.reserve(rec->args.size());
         for (auto &a : rec->args) {
-            if (a.name) {
-                a.name = guarded_strdup(a.name);
-            }
-            if (a.descr) {
-                a.descr = guarded_strdup(a.descr);
-            } else if (a.value) {
-                a.descr = guarded_strdup(repr(a.value).cast<std::string>().c_str());
+            if (!a.descr && a.value) {
+                value_reprs.push_back(repr(a.value).cast<std::string>());
+                a.descr = value_reprs.back().c_str();
             }
         }
 
@@ -462,12 +473,60 @@ protected:
             pybind11_fail("Internal error while parsing type signature (2)");
         }
 
-        rec->signature = guarded_strdup(signature.c_str());
+        /* Copy the name, the argument names and defaults and the signature into a single
+           allocation. It starts with the name, through which `destruct` frees it. */
+        size_t strings_size = std::strlen(rec->name) + 1 + signature.size() + 1;
+        for (const auto &a : rec->args) {
+            strings_size += (a.name ? std::strlen(a.name) + 1 : 0)
+                            + (a.descr ? std::strlen(a.descr) + 1 : 0);
+        }
+        char *strings = guarded_strdup.allocate(strings_size);
+        auto copy_string = [&strings](const char *s) {
+            const size_t size = std::strlen(s) + 1;
+            std::memcpy(strings, s, size);
+            strings += size;
+            return strings - size;
+        };
+        rec->name = copy_string(rec->name);
+        for (auto &a : rec->args) {
+            if (a.name) {
+                a.name = copy_string(a.name);
+            }
+            if (a.descr) {
+                a.descr = copy_string(a.descr);
+            }
+        }
+        rec->signature = copy_string(signature.c_str());
+        if (rec->doc) {
+            rec->doc = guarded_strdup(rec->doc);
+        }
         rec->args.shrink_to_fit();
         rec->nargs = (std::uint16_t) args;
+        rec->positional_only_call = !rec->is_constructor && !rec->has_args && !rec->has_kwargs
+                                    && rec->nargs_pos == rec->nargs;
+
+        /* Intern the argument names once, so that keyword arguments passed by the caller (whose
+           keys are almost always interned as well) are usually matched by identity. */
+        if (std::any_of(rec->args.begin(), rec->args.end(), [](const detail::argument_record &a) {
+                return a.name != nullptr;
+            })) {
+            rec->arg_names = PyTuple_New((ssize_t) rec->args.size());
+            if (!rec->arg_names) {
+                throw error_already_set();
+            }
+            for (size_t i = 0; i < rec->args.size(); ++i) {
+                const char *name = rec->args[i].name;
+                PyObject *item = name ? PyUnicode_InternFromString(name) : none().release().ptr();
+                if (!item) {
+                    throw error_already_set();
+                }
+                PyTuple_SET_ITEM(rec->arg_names.ptr(), (ssize_t) i, item);
+            }
+        }
 
-        if (rec->sibling && PYBIND11_INSTANCE_METHOD_CHECK(rec->sibling.ptr())) {
-            rec->sibling = PYBIND11_INSTANCE_METHOD_GET_FUNCTION(rec->sibling.ptr());
+        if (rec->sibling && (PYBIND11_INSTANCE_METHOD_CHECK(rec->sibling.ptr())
+                             || detail::is_method_descriptor(rec->sibling))) {
+            rec->sibling = detail::get_function(rec->sibling);
         }
 
         detail::function_record *chain = nullptr, *chain_start = rec;
@@ -617,7 +676,7 @@ protected:
             = signatures.empty() ? nullptr : PYBIND11_COMPAT_STRDUP(signatures.c_str());
 
         if (rec->is_method) {
-            m_ptr = PYBIND11_INSTANCE_METHOD_NEW(m_ptr, rec->scope.ptr());
+            m_ptr = detail::make_method_descriptor(m_ptr);
             if (!m_ptr) {
                 pybind11_fail(
                     "cpp_function::cpp_function(): Could not allocate instance method object");
@@ -642,18 +701,15 @@ protected:
             // During initialization, these strings might not have been copied yet,
             // so they cannot be freed. Once the function has been created, they can.
             // Check `make_function_record` for more details.
+            // The argument names and defaults and the signature share the name's allocation.
             if (free_strings) {
                 std::free((char *) rec->name);
                 std::free((char *) rec->doc);
-                std::free((char *) rec->signature);
-                for (auto &arg : rec->args) {
-                    std::free(const_cast<char *>(arg.name));
-                    std::free(const_cast<char *>(arg.descr));
-                }
             }
             for (auto &arg : rec->args) {
                 arg.value.dec_ref();
             }
+            rec->arg_names.dec_ref();
             if (rec->def) {
                 std::free(const_cast<char *>(rec->def->ml_doc));
 // Python 3.9.0 decref's these in the wrong order; rec->def
@@ -721,7 +777,36 @@ protected:
             // However, if there are no overloads, we can just skip the no-convert pass entirely
             const bool overloaded = it != nullptr && it->next != nullptr;
 
-            for (; it != nullptr; it = it->next) {
+            // The most common call of all, a single overload given exactly its positional
+            // arguments, maps the arguments one-to-one and skips the resolution loop below
+            const bool positional_call
+                = !overloaded && overloads->positional_only_call && n_args_in == overloads->nargs
+                  && (!kwargs_in || PyDict_Size(kwargs_in) == 0);
+            if (positional_call) {
+                function_call call(*overloads, parent);
+                bool bad_arg = false;
+                for (size_t i = 0; i < n_args_in; ++i) {
+                    const argument_record *arg_rec
+                        = i < overloads->args.size() ? &overloads->args[i] : nullptr;
+                    handle arg(PyTuple_GET_ITEM(args_in, i));
+                    if (arg_rec && !arg_rec->none && arg.is_none()) {
+                        bad_arg = true;
+                        break;
+                    }
+                    call.args.push_back(arg);
+                    call.args_convert.push_back(arg_rec ? arg_rec->convert : true);
+                }
+                if (!bad_arg) {
+                    try {
+                        loader_life_support guard{};
+                        result = overloads->impl(call);
+                    } catch (reference_cast_error &) {
+                        result = PYBIND11_TRY_NEXT_OVERLOAD;
+                    }
+                }
+            }
+
+            for (; it != nullptr && !positional_call; it = it->next) {
 
                 /* For each overload:
                    1. Copy all positional arguments we were given, also checking to make sure that
@@ -787,7 +872,7 @@ protected:
                     const argument_record *arg_rec
                         = args_copied < func.args.size() ? &func.args[args_copied] : nullptr;
                     if (kwargs_in && arg_rec && arg_rec->name
-                        && dict_getitemstring(kwargs_in, arg_rec->name)) {
+                        && dict_getitem(kwargs_in, func.arg_name(args_copied))) {
                         bad_arg = true;
                         break;
                     }
@@ -808,8 +893,9 @@ protected:
                 // to copy the rest into a py::args argument.
                 size_t positional_args_copied = args_copied;
 
-                // We'll need to copy this if we steal some kwargs for defaults
-                dict kwargs = reinterpret_borrow<dict>(kwargs_in);
+                // Keyword arguments are only counted while matching; the kwargs dict is copied
+                // (in step 4b) only if a py::kwargs argument receives a subset of it.
+                size_t kwargs_consumed = 0;
 
                 // 1.5. Fill in any missing pos_only args from defaults if they exist
                 if (args_copied < func.nargs_pos_only) {
@@ -834,26 +920,19 @@ protected:
                 }
 
                 // 2. Check kwargs and, failing that, defaults that may help complete the list
+                size_t keyword_args_start = args_copied;
                 if (args_copied < num_args) {
-                    bool copied_kwargs = false;
-
                     for (; args_copied < num_args; ++args_copied) {
                         const auto &arg_rec = func.args[args_copied];
 
                         handle value;
                         if (kwargs_in && arg_rec.name) {
-                            value = dict_getitemstring(kwargs.ptr(), arg_rec.name);
+                            value = dict_getitem(kwargs_in, func.arg_name(args_copied));
                         }
 
                         if (value) {
                             // Consume a kwargs value
-                            if (!copied_kwargs) {
-                                kwargs = reinterpret_steal<dict>(PyDict_Copy(kwargs.ptr()));
-                                copied_kwargs = true;
-                            }
-                            if (PyDict_DelItemString(kwargs.ptr(), arg_rec.name) == -1) {
-                                throw error_already_set();
-                            }
+                            ++kwargs_consumed;
                         } else if (arg_rec.value) {
                             value = arg_rec.value;
                         }
@@ -883,7 +962,10 @@ protected:
                 }
 
                 // 3. Check everything was consumed (unless we have a kwargs arg)
-                if (kwargs && !kwargs.empty() && !func.has_kwargs) {
+                const size_t kwargs_given = kwargs_in ? (size_t) PyDict_Size(kwargs_in) : 0;
+                const size_t kwargs_left
+                    = kwargs_given > kwargs_consumed ? kwargs_given - kwargs_consumed : 0;
+                if (kwargs_left > 0 && !func.has_kwargs) {
                     continue; // Unconsumed kwargs, but no py::kwargs argument to accept them
                 }
 
@@ -914,8 +996,21 @@ protected:
 
                 // 4b. If we have a py::kwargs, pass on any remaining kwargs
                 if (func.has_kwargs) {
-                    if (!kwargs.ptr()) {
-                        kwargs = dict(); // If we didn't get one, send an empty one
+                    dict kwargs = kwargs_left == 0      ? dict()
+                                  : kwargs_consumed == 0 ? reinterpret_borrow<dict>(kwargs_in)
+                                                         : reinterpret_steal<dict>(
+                                                             PyDict_Copy(kwargs_in));
+                    if (!kwargs) {
+                        throw error_already_set();
+                    }
+                    if (kwargs_consumed > 0 && kwargs_left > 0) {
+                        // Every named argument from step 2 was taken from kwargs if present
+                        for (size_t i = keyword_args_start; i < num_args; ++i) {
+                            if (func.args[i].name
+                                && PyDict_DelItem(kwargs.ptr(), func.arg_name(i)) == -1) {
+                                PyErr_Clear();
+                            }
+                        }
                     }
                     call.args.push_back(kwargs);
                     call.args_convert.push_back(false);
@@ -1324,7 +1419,7 @@ protected:
         tinfo->type_size = rec.type_size;
         tinfo->type_align = rec.type_align;
         tinfo->operator_new = rec.operator_new;
-        tinfo->holder_size_in_ptrs = size_in_ptrs(rec.holder_size);
+        tinfo->holder_size_in_ptrs = rec.holder_size == 0 ? 0 : size_in_ptrs(rec.holder_size);
         tinfo->init_instance = rec.init_instance;
         tinfo->dealloc = rec.dealloc;
         tinfo->simple_type = true;
@@ -1340,6 +1435,7 @@ protected:
         } else {
             internals.registered_types_cpp[tindex] = tinfo;
         }
+        type_registry_changed();
         internals.registered_types_py[(PyTypeObject *) m_ptr] = {tinfo};
 
         if (rec.bases.size() > 1 || rec.multiple_inheritance) {
@@ -1416,49 +1512,26 @@ void set_operator_new(type_record *r) {
 template <typename>
 void set_operator_new(...) {}
 
-template <typename T, typename SFINAE = void>
-struct has_operator_delete : std::false_type {};
-template <typename T>
-struct has_operator_delete<T, void_t<decltype(static_cast<void (*)(void *)>(T::operator delete))>>
-    : std::true_type {};
-template <typename T, typename SFINAE = void>
-struct has_operator_delete_size : std::false_type {};
-template <typename T>
-struct has_operator_delete_size<
-    T,
-    void_t<decltype(static_cast<void (*)(void *, size_t)>(T::operator delete))>> : std::true_type {
-};
-/// Call class-specific delete if it exists or global otherwise. Can also be an overload set.
-template <typename T, enable_if_t<has_operator_delete<T>::value, int> = 0>
-void call_operator_delete(T *p, size_t, size_t) {
-    T::operator delete(p);
-}
+/// Override `__sizeof__` to add the heap memory reported by `sizeof_hook<T>`, if specialized
 template <typename T,
-          enable_if_t<!has_operator_delete<T>::value && has_operator_delete_size<T>::value, int>
-          = 0>
-void call_operator_delete(T *p, size_t s, size_t) {
-    T::operator delete(p, s);
+          typename = void_t<decltype(sizeof_hook<T>::owned_bytes(std::declval<const T &>()))>>
+void add_sizeof_hook(object &cls) {
+    cls.attr("__sizeof__") = cpp_function(
+        [](handle self) {
+            auto *inst = reinterpret_cast<instance *>(self.ptr());
+            value_and_holder v_h = inst->get_value_and_holder(get_type_info<T>());
+            size_t size = instance_sizeof(inst);
+            if (v_h && (inst->owned || v_h.holder_constructed())) {
+                size += sizeof_hook<T>::owned_bytes(*v_h.value_ptr<T>());
+            }
+            return size;
+        },
+        name("__sizeof__"),
+        is_method(cls));
 }
 
-inline void call_operator_delete(void *p, size_t s, size_t a) {
-    (void) s;
-    (void) a;
-#if defined(__cpp_aligned_new) && (!defined(_MSC_VER) || _MSC_VER >= 1912)
-    if (a > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
-#    ifdef __cpp_sized_deallocation
-        ::operator delete(p, s, std::align_val_t(a));
-#    else
-        ::operator delete(p, std::align_val_t(a));
-#    endif
-        return;
-    }
-#endif
-#ifdef __cpp_sized_deallocation
-    ::operator delete(p, s);
-#else
-    ::operator delete(p);
-#endif
-}
+template <typename>
+void add_sizeof_hook(...) {}
 
 inline void add_class_method(object &cls, const char *name_, const cpp_function &cf) {
     cls.attr(cf.name()) = cf;
@@ -1537,7 +1610,8 @@ public:
         record.type = &typeid(type);
         record.type_size = sizeof(conditional_t<has_alias, type_alias, type>);
         record.type_align = alignof(conditional_t<has_alias, type_alias, type> &);
-        record.holder_size = sizeof(holder_type);
+        record.holder_size
+            = detail::holder_in_value_slot<holder_type>::value ? 0 : sizeof(holder_type);
         record.init_instance = init_instance;
         record.dealloc = dealloc;
         record.default_holder = detail::is_instantiation<std::unique_ptr, holder_type>::value;
@@ -1550,13 +1624,22 @@ public:
         /* Process optional arguments, if any */
         process_attributes<Extra...>::init(extra..., &record);
 
+        // Checked here rather than in make_new_python_type(), which may live in pybind11::runtime
+        // and would see that library's options instead of this module's
+        if (!pybind11::options::show_user_defined_docstrings()) {
+            record.doc = nullptr;
+        }
+
         generic_type::initialize(record);
 
+        add_sizeof_hook<type>(*this);
+
         if (has_alias) {
             auto &instances = record.module_local ? get_local_internals().registered_types_cpp
                                                   : get_internals().registered_types_cpp;
             instances[std::type_index(typeid(type_alias))]
                 = instances[std::type_index(typeid(type))];
+            detail::type_registry_changed();
         }
     }
 
@@ -1627,6 +1710,12 @@ public:
         return *this;
     }
 
+    template <typename... Args, typename... Extra>
+    class_ &def(detail::initimpl::placement_factory<Args...> &&init, const Extra &...extra) {
+        std::move(init).execute(*this, extra...);
+        return *this;
+    }
+
     template <typename... Args, typename... Extra>
     class_ &def(detail::initimpl::pickle_factory<Args...> &&pf, const Extra &...extra) {
         std::move(pf).execute(*this, extra...);
@@ -1845,7 +1934,13 @@ private:
                             detail::value_and_holder &v_h,
                             const holder_type *holder_ptr,
                             const void * /* dummy -- not enable_shared_from_this<T>) */) {
-        if (holder_ptr) {
+        if (holder_ptr && detail::holder_in_value_slot<holder_type>::value) {
+            // The existing holder may point to a base subobject (e.g. a holder of a non-primary
+            // base returned for a more derived type), while the slot must keep the most derived
+            // pointer: reference the object through that instead of copying the holder.
+            new (std::addressof(v_h.holder<holder_type>())) holder_type(v_h.value_ptr<type>());
+            v_h.set_holder_constructed();
+        } else if (holder_ptr) {
             init_holder_from_existing(v_h, holder_ptr, std::is_copy_constructible<holder_type>());
             v_h.set_holder_constructed();
         } else if (detail::always_construct_holder<holder_type>::value || inst->owned) {
@@ -1925,6 +2020,14 @@ Ret init(Func &&f) {
     return {std::forward<Func>(f)};
 }
 
+/// Binds a placement factory as a constructor: `f(void *storage, args...)` must construct the
+/// instance in the given uninitialized storage (e.g. with placement new).  This avoids moving the
+/// result of a return-by-value factory into a new allocation, and works for non-movable types.
+template <typename Func, typename Ret = detail::initimpl::placement_factory<Func>>
+Ret init_placement(Func &&f) {
+    return {std::forward<Func>(f)};
+}
+
 /// Dual-argument factory function: the first function is called when no alias is needed, the
 /// second when an alias is needed (i.e. due to python-side inheritance).  Arguments must be
 /// identical.
@@ -2165,6 +2268,29 @@ using equivalent_integer_t =
 
 PYBIND11_NAMESPACE_END(detail)
 
+/// Enables (or disables) counting the live instances of all pybind11 types for `live_instances()`.
+/// Only instances created while tracking is enabled are counted. Disabling it drops the counts.
+inline void track_live_instances(bool enable = true) {
+    auto &stats = detail::registered_instance_stats();
+    stats.enabled = enable;
+    if (!enable) {
+        stats.types.clear();
+    }
+}
+
+/// Returns a dict mapping each pybind11 type with live instances (in any module) to a tuple of
+/// the number of instances and the combined C++ `sizeof` of the values they own. Instances that
+/// only reference a C++ value are counted, but not included in the size. Types without live
+/// instances are omitted, as are all types while `track_live_instances()` is disabled.
+inline dict live_instances() {
+    dict result;
+    for (const auto &entry : detail::registered_instance_stats().types) {
+        result[handle((PyObject *) entry.first)]
+            = make_tuple(entry.second.count, entry.second.bytes);
+    }
+    return result;
+}
+
 /// Binds C++ enumerations and enumeration classes to Python
 template <typename Type>
 class enum_ : public class_<Type> {
@@ -2477,6 +2603,36 @@ iterator make_value_iterator(Type &value, Extra &&...extra) {
         std::begin(value), std::end(value), std::forward<Extra>(extra)...);
 }
 
+PYBIND11_NAMESPACE_BEGIN(detail)
+
+template <typename InputType>
+using implicit_source_t
+    = decltype(cast_op<InputType>(std::declval<make_caster<InputType>>()));
+
+/// Converter registered by `implicitly_convertible(direct_conversion())`: builds the value on the
+/// heap without creating a Python instance of `OutputType`, and ties its lifetime to the current
+/// call through `loader_life_support`.
+template <typename InputType, typename OutputType>
+bool implicit_direct_converter(PyObject *obj, void *&value) {
+    make_caster<InputType> caster;
+    if (!caster.load(obj, false)) {
+        return false;
+    }
+    OutputType *result = nullptr;
+    try {
+        result = new OutputType(cast_op<InputType>(std::move(caster)));
+    } catch (...) {
+        // Same as a failing Python constructor: the conversion simply doesn't apply
+        return false;
+    }
+    capsule owner(result, [](void *ptr) { delete static_cast<OutputType *>(ptr); });
+    loader_life_support::add_patient(owner);
+    value = result;
+    return true;
+}
+
+PYBIND11_NAMESPACE_END(detail)
+
 template <typename InputType, typename OutputType>
 void implicitly_convertible() {
     struct set_flag {
@@ -2509,6 +2665,38 @@ void implicitly_convertible() {
     }
 }
 
+/// Tag for `implicitly_convertible` that requests the converted value to be constructed by
+/// calling the C++ constructor `OutputType(InputType)` instead of the Python type
+struct direct_conversion {};
+
+/// Like `implicitly_convertible<InputType, OutputType>()`, but without creating a temporary Python
+/// instance of `OutputType`. Both types must be registered, and `OutputType`'s C++ constructor
+/// must do the same as its Python `__init__` would for an `InputType` argument.
+template <typename InputType, typename OutputType>
+void implicitly_convertible(direct_conversion) {
+    static_assert(
+        std::is_constructible<OutputType, detail::implicit_source_t<InputType>>::value,
+        "implicitly_convertible(direct_conversion()) requires OutputType to be constructible from "
+        "InputType");
+    auto *tinfo = detail::get_type_info(typeid(OutputType));
+    if (!tinfo) {
+        pybind11_fail("implicitly_convertible: Unable to find type " + type_id<OutputType>());
+    }
+    if (!detail::get_type_info(typeid(InputType))) {
+        pybind11_fail("implicitly_convertible: Unable to find type " + type_id<InputType>());
+    }
+    // The value only lives until the call returns, which is what a plain std::unique_ptr holder
+    // would give it too; other holders (shared_ptr, intrusive counts) may need it to outlive the
+    // call. Module-local types are excluded as well, since the direct converter list is shared by
+    // all registrations of the C++ type. Both fall back to the Python route.
+    if (tinfo->default_holder && !tinfo->module_local) {
+        tinfo->direct_conversions->push_back(
+            &detail::implicit_direct_converter<InputType, OutputType>);
+    } else {
+        implicitly_convertible<InputType, OutputType>();
+    }
+}
+
 inline void register_exception_translator(ExceptionTranslator &&translator) {
     detail::get_internals().registered_exception_translators.push_front(
         std::forward<ExceptionTranslator>(translator));
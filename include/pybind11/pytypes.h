@@ -920,10 +920,36 @@ inline ssize_t hash(handle obj) {
 /// @} python_builtins
 
 PYBIND11_NAMESPACE_BEGIN(detail)
+#if !defined(PYPY_VERSION)
+/// Object layout of `pybind11_method`, the descriptor type of methods (see detail/class.h)
+struct method_descriptor {
+    PyObject_HEAD
+    PyObject *func;
+#    if PY_VERSION_HEX >= 0x03090000
+    vectorcallfunc vectorcall;
+#    endif
+};
+#endif
+
+/// True for the `pybind11_method` descriptors holding the methods of pybind11 classes. There
+/// is one such type per set of internals, so it is recognized by name.
+inline bool is_method_descriptor(handle value) {
+#if defined(PYPY_VERSION)
+    (void) value;
+    return false;
+#else
+    return std::strcmp(Py_TYPE(value.ptr())->tp_name, "pybind11_method") == 0;
+#endif
+}
+
 inline handle get_function(handle value) {
     if (value) {
         if (PyInstanceMethod_Check(value.ptr())) {
             value = PyInstanceMethod_GET_FUNCTION(value.ptr());
+#if !defined(PYPY_VERSION)
+        } else if (is_method_descriptor(value)) {
+            value = reinterpret_cast<method_descriptor *>(value.ptr())->func;
+#endif
         } else if (PyMethod_Check(value.ptr())) {
             value = PyMethod_GET_FUNCTION(value.ptr());
         }
@@ -2231,6 +2257,19 @@ public:
         }
         return buffer_info(view);
     }
+
+    /// Like ``request()``, but returns a ``buffer_view`` that does not allocate.
+    buffer_view view(bool writable = false) const {
+        int flags = PyBUF_STRIDES | PyBUF_FORMAT;
+        if (writable) {
+            flags |= PyBUF_WRITABLE;
+        }
+        buffer_view result;
+        if (PyObject_GetBuffer(m_ptr, result.view(), flags) != 0) {
+            throw error_already_set();
+        }
+        return result;
+    }
 };
 
 class memoryview : public object {
@@ -12,7 +12,9 @@
 #include "pybind11.h"
 #include "detail/common.h"
 
+#include <cstring>
 #include <deque>
+#include <limits>
 #include <list>
 #include <map>
 #include <ostream>
@@ -20,6 +22,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <valarray>
+#include <vector>
 
 // See `detail/common.h` for implementation of these guards.
 #if defined(PYBIND11_HAS_OPTIONAL)
@@ -32,6 +35,13 @@
 #    include <variant>
 #endif
 
+#if defined(PYBIND11_HAS_SPAN)
+#    include <span>
+#    if __has_include(<mdspan>)
+#        include <mdspan>
+#    endif
+#endif
+
 PYBIND11_NAMESPACE_BEGIN(PYBIND11_NAMESPACE)
 PYBIND11_NAMESPACE_BEGIN(detail)
 
@@ -161,6 +171,133 @@ public:
                              + const_name("]"));
 };
 
+/// Calls `f((C *) nullptr)` with the C type of a native single-item buffer format, or returns
+/// false for any other format.
+template <typename F>
+bool visit_native_format(const char *format, F &&f) {
+    if (*format == '@') {
+        ++format;
+    }
+    if (format[0] == '\0' || format[1] != '\0') {
+        return false;
+    }
+    switch (format[0]) {
+        case '?':
+            return f((bool *) nullptr);
+        case 'b':
+            return f((signed char *) nullptr);
+        case 'B':
+            return f((unsigned char *) nullptr);
+        case 'h':
+            return f((short *) nullptr);
+        case 'H':
+            return f((unsigned short *) nullptr);
+        case 'i':
+            return f((int *) nullptr);
+        case 'I':
+            return f((unsigned int *) nullptr);
+        case 'l':
+            return f((long *) nullptr);
+        case 'L':
+            return f((unsigned long *) nullptr);
+        case 'q':
+            return f((long long *) nullptr);
+        case 'Q':
+            return f((unsigned long long *) nullptr);
+        case 'n':
+            return f((ssize_t *) nullptr);
+        case 'N':
+            return f((size_t *) nullptr);
+        case 'f':
+            return f((float *) nullptr);
+        case 'd':
+            return f((double *) nullptr);
+        default:
+            return false;
+    }
+}
+
+/// Copies `count` strided buffer items into `out`, converting them the way the scalar casters
+/// would: integers of any width (range checked), and -- only with `convert` -- integers or other
+/// floating point types into floating point. Returns false, with `out` partly written, for
+/// anything else so that the caller can fall back to element-wise conversion.
+template <typename T>
+struct buffer_items_reader {
+    const char *data;
+    ssize_t count;
+    ssize_t stride;
+    bool convert;
+    T *out;
+
+    template <typename Src>
+    bool operator()(Src *) const {
+        if (!accepts<Src>()) {
+            return false;
+        }
+        for (ssize_t i = 0; i < count; ++i) {
+            Src v;
+            std::memcpy(&v, data + i * stride, sizeof(Src));
+            if (!fits(v)) {
+                return false;
+            }
+            out[i] = static_cast<T>(v);
+        }
+        return true;
+    }
+
+private:
+    template <typename Src>
+    bool accepts() const {
+        if (std::is_same<Src, bool>::value || std::is_same<T, bool>::value) {
+            return std::is_same<Src, T>::value;
+        }
+        if (std::is_integral<T>::value) {
+            return std::is_integral<Src>::value;
+        }
+        return (std::is_floating_point<Src>::value && sizeof(Src) == sizeof(T)) || convert;
+    }
+
+    template <typename Src, enable_if_t<std::is_signed<Src>::value, int> = 0>
+    static bool negative(Src v) {
+        return v < 0;
+    }
+    template <typename Src, enable_if_t<!std::is_signed<Src>::value, int> = 0>
+    static bool negative(Src) {
+        return false;
+    }
+
+    template <typename Src,
+              enable_if_t<std::is_integral<Src>::value && std::is_integral<T>::value, int> = 0>
+    static bool fits(Src v) {
+        if (negative(v)) {
+            return std::is_signed<T>::value
+                   && static_cast<long long>(v)
+                          >= static_cast<long long>((std::numeric_limits<T>::min)());
+        }
+        return static_cast<unsigned long long>(v)
+               <= static_cast<unsigned long long>((std::numeric_limits<T>::max)());
+    }
+    template <typename Src,
+              enable_if_t<!std::is_integral<Src>::value || !std::is_integral<T>::value, int> = 0>
+    static bool fits(Src) {
+        return true;
+    }
+};
+
+template <typename T, typename SFINAE = void>
+struct is_buffer_loadable_vector : std::false_type {};
+template <typename T, typename Alloc>
+struct is_buffer_loadable_vector<
+    std::vector<T, Alloc>,
+    enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value
+                && !is_std_char_type<T>::value>>
+    : std::true_type {};
+
+template <typename T>
+struct is_bool_vector : std::false_type {};
+template <typename Alloc>
+struct is_bool_vector<std::vector<bool, Alloc>> : std::true_type {};
+
 template <typename Type, typename Value>
 struct list_caster {
     using value_conv = make_caster<Value>;
@@ -169,6 +306,9 @@ struct list_caster {
         if (!isinstance<sequence>(src) || isinstance<bytes>(src) || isinstance<str>(src)) {
             return false;
         }
+        if (load_buffer(src, convert, &value)) {
+            return true;
+        }
         auto s = reinterpret_borrow<sequence>(src);
         value.clear();
         reserve_maybe(s, &value);
@@ -183,6 +323,87 @@ struct list_caster {
     }
 
 private:
+    // Vectors of numbers (or of vectors of numbers) are filled straight from the strided memory
+    // of a 1-D (2-D) buffer source instead of going through one Python object per item (row).
+    // Anything the fast path does not handle exactly like the element-wise path falls back to it.
+    template <typename T = Type, enable_if_t<is_buffer_loadable_vector<T>::value, int> = 0>
+    bool load_buffer(handle src, bool convert, Type *) {
+        buffer_view view;
+        if (!request_buffer_view(src, view) || view.ndim() != 1) {
+            return false;
+        }
+        value.resize(static_cast<size_t>(view.shape(0)));
+        return visit_native_format(view.format(),
+                                   buffer_items_reader<Value>{static_cast<const char *>(view.ptr()),
+                                                              view.shape(0),
+                                                              view.strides(0),
+                                                              convert,
+                                                              value.data()});
+    }
+
+    template <typename T = Type,
+              enable_if_t<!is_buffer_loadable_vector<T>::value
+                              && is_buffer_loadable_vector<Value>::value,
+                          int>
+              = 0>
+    bool load_buffer(handle src, bool convert, Type *) {
+        buffer_view view;
+        if (!request_buffer_view(src, view) || view.ndim() != 2) {
+            return false;
+        }
+        const auto rows = static_cast<size_t>(view.shape(0));
+        const auto cols = static_cast<size_t>(view.shape(1));
+        value.clear();
+        value.resize(rows);
+        for (size_t r = 0; r < rows; ++r) {
+            value[r].resize(cols);
+            buffer_items_reader<typename Value::value_type> reader{
+                static_cast<const char *>(view.ptr()) + static_cast<ssize_t>(r) * view.strides(0),
+                view.shape(1),
+                view.strides(1),
+                convert,
+                value[r].data()};
+            if (!visit_native_format(view.format(), reader)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename T = Type, enable_if_t<is_bool_vector<T>::value, int> = 0>
+    bool load_buffer(handle src, bool, Type *) {
+        buffer_view view;
+        if (!request_buffer_view(src, view) || view.ndim() != 1) {
+            return false;
+        }
+        const char *format = view.format();
+        if (std::strcmp(format, "?") != 0 && std::strcmp(format, "@?") != 0) {
+            return false;
+        }
+        const auto *data = static_cast<const unsigned char *>(view.ptr());
+        const ssize_t n = view.shape(0);
+        value.assign(static_cast<size_t>(n), false);
+        for (ssize_t i = 0; i < n; ++i) {
+            if (data[i * view.strides(0)] != 0) {
+                value[static_cast<size_t>(i)] = true;
+            }
+        }
+        return true;
+    }
+
+    bool load_buffer(handle, bool, void *) { return false; }
+
+    static bool request_buffer_view(handle src, buffer_view &view) {
+        if (!PyObject_CheckBuffer(src.ptr())) {
+            return false;
+        }
+        if (PyObject_GetBuffer(src.ptr(), view.view(), PyBUF_STRIDES | PyBUF_FORMAT) != 0) {
+            PyErr_Clear();
+            return false;
+        }
+        return true;
+    }
+
     template <typename T = Type, enable_if_t<has_reserve_method<T>::value, int> = 0>
     void reserve_maybe(const sequence &s, Type *) {
         value.reserve(s.size());
@@ -197,9 +418,14 @@ public:
         }
         list l(src.size());
         ssize_t index = 0;
+        const type_info *moved_type = policy == return_value_policy::move
+                                          ? moved_value_type(moves_registered_values<T>{})
+                                          : nullptr;
         for (auto &&value : src) {
             auto value_ = reinterpret_steal<object>(
-                value_conv::cast(detail::forward_like<T>(value), policy, parent));
+                moved_type != nullptr
+                    ? cast_moved(value, moved_type, moves_registered_values<T>{})
+                    : value_conv::cast(detail::forward_like<T>(value), policy, parent));
             if (!value_) {
                 return handle();
             }
@@ -208,6 +434,30 @@ public:
         return l.release();
     }
 
+private:
+    // Elements of a container returned by value that hold a registered type are cast in bulk:
+    // the type is looked up once and the registered-instance probe is skipped for each value.
+    template <typename T>
+    using moves_registered_values
+        = bool_constant<!std::is_lvalue_reference<T>::value
+                        && !std::is_const<remove_reference_t<T>>::value
+                        && std::is_base_of<type_caster_base<Value>, value_conv>::value>;
+
+    static const type_info *moved_value_type(std::true_type) {
+        return type_caster_base<Value>::moved_type_info();
+    }
+    static const type_info *moved_value_type(std::false_type) { return nullptr; }
+
+    template <typename V>
+    static handle cast_moved(V &value, const type_info *tinfo, std::true_type) {
+        return type_caster_base<Value>::cast_moved(std::move(value), tinfo);
+    }
+    template <typename V>
+    static handle cast_moved(V &, const type_info *, std::false_type) {
+        return handle();
+    }
+
+public:
     PYBIND11_TYPE_CASTER(Type, const_name("List[") + value_conv::name + const_name("]"));
 };
 
@@ -433,6 +683,178 @@ template <>
 struct type_caster<std::monostate> : public void_caster<std::monostate> {};
 #endif
 
+#if defined(PYBIND11_HAS_SPAN)
+template <typename T, typename SFINAE = void>
+struct has_buffer_format : std::false_type {};
+template <typename T>
+struct has_buffer_format<T, void_t<decltype(format_descriptor<T>::format())>> : std::true_type {};
+
+/// Acquires a C-contiguous view of `src` whose item type is `T`, or leaves `info` empty (and the
+/// Python error indicator clear) when `src` does not expose such a buffer.
+template <typename T>
+bool request_typed_buffer(handle src, bool writable, buffer_info &info) {
+    if (!PyObject_CheckBuffer(src.ptr())) {
+        return false;
+    }
+    auto *view = new Py_buffer();
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT | (writable ? PyBUF_WRITABLE : 0);
+    if (PyObject_GetBuffer(src.ptr(), view, flags) != 0) {
+        delete view;
+        PyErr_Clear();
+        return false;
+    }
+    info = buffer_info(view);
+    if (!info.item_type_is_equivalent_to<T>()) {
+        info = buffer_info();
+        return false;
+    }
+    return true;
+}
+
+/// Binds ``std::span<T>`` directly to the memory of a buffer-protocol object (NumPy arrays,
+/// ``memoryview``, ``bytearray``, vectors bound with ``py::buffer_protocol()``).  The buffer must
+/// be one-dimensional, C-contiguous and of a format equivalent to ``T``; a mutable span also
+/// requires a writable buffer.  Nothing is copied: the caster holds the acquired buffer for the
+/// duration of the call.  Spans of ``const T`` may fall back to a converted copy of any sequence
+/// when implicit conversions are allowed.  Spans are returned to Python as a list copy.
+template <typename T, size_t Extent>
+class type_caster<std::span<T, Extent>, enable_if_t<has_buffer_format<remove_cv_t<T>>::value>> {
+    using Span = std::span<T, Extent>;
+    using value_type = remove_cv_t<T>;
+    using value_conv = make_caster<value_type>;
+
+public:
+    bool load(handle src, bool convert) {
+        if (request_typed_buffer<value_type>(src, !std::is_const<T>::value, buf)) {
+            if (buf.ndim != 1 || !extent_matches((size_t) buf.size)) {
+                buf = buffer_info();
+                return false;
+            }
+            data = static_cast<T *>(buf.ptr);
+            size = (size_t) buf.size;
+            return true;
+        }
+        if (!std::is_const<T>::value || !convert) {
+            return false;
+        }
+        make_caster<std::vector<value_type>> conv;
+        if (!conv.load(src, convert)) {
+            return false;
+        }
+        copy = cast_op<std::vector<value_type> &&>(std::move(conv));
+        if (!extent_matches(copy.size())) {
+            return false;
+        }
+        data = copy.data();
+        size = copy.size();
+        return true;
+    }
+
+    static handle cast(Span src, return_value_policy policy, handle parent) {
+        list l(src.size());
+        ssize_t index = 0;
+        for (auto &value : src) {
+            auto value_ = reinterpret_steal<object>(value_conv::cast(value, policy, parent));
+            if (!value_) {
+                return handle();
+            }
+            PyList_SET_ITEM(l.ptr(), index++, value_.release().ptr()); // steals a reference
+        }
+        return l.release();
+    }
+
+    static constexpr auto name = const_name("Buffer[") + value_conv::name + const_name("]");
+    template <typename>
+    using cast_op_type = Span;
+    explicit operator Span() { return Span(data, size); }
+
+private:
+    static bool extent_matches(size_t n) { return Extent == std::dynamic_extent || n == Extent; }
+
+    buffer_info buf;
+    std::vector<value_type> copy;
+    T *data = nullptr;
+    size_t size = 0;
+};
+
+#    if defined(__cpp_lib_mdspan)
+/// Binds ``std::mdspan`` to the memory of a buffer-protocol object without copying.  The buffer's
+/// rank, static extents and item format must match; ``layout_right`` requires a C-contiguous
+/// buffer, ``layout_left`` an F-contiguous one, and ``layout_stride`` accepts any positive strides
+/// that are a whole multiple of the item size.  mdspan values are only accepted as arguments.
+template <typename T, typename Extents, typename Layout>
+class type_caster<std::mdspan<T, Extents, Layout>,
+                  enable_if_t<has_buffer_format<remove_cv_t<T>>::value>> {
+    using Mdspan = std::mdspan<T, Extents, Layout>;
+    using value_type = remove_cv_t<T>;
+    using index_type = typename Extents::index_type;
+    static constexpr size_t rank = Extents::rank();
+
+public:
+    bool load(handle src, bool) {
+        if (!PyObject_CheckBuffer(src.ptr())) {
+            return false;
+        }
+        auto *view = new Py_buffer();
+        int flags = layout_flags() | PyBUF_FORMAT
+                    | (std::is_const<T>::value ? 0 : PyBUF_WRITABLE);
+        if (PyObject_GetBuffer(src.ptr(), view, flags) != 0) {
+            delete view;
+            PyErr_Clear();
+            return false;
+        }
+        buf = buffer_info(view);
+        if (!buf.item_type_is_equivalent_to<value_type>() || (size_t) buf.ndim != rank) {
+            return false;
+        }
+        std::array<index_type, rank> extents{};
+        for (size_t i = 0; i < rank; ++i) {
+            if (Extents::static_extent(i) != std::dynamic_extent
+                && (size_t) buf.shape[i] != Extents::static_extent(i)) {
+                return false;
+            }
+            extents[i] = (index_type) buf.shape[i];
+        }
+        auto *ptr = static_cast<T *>(buf.ptr);
+        if constexpr (std::is_same<Layout, std::layout_stride>::value) {
+            std::array<index_type, rank> strides{};
+            for (size_t i = 0; i < rank; ++i) {
+                if (buf.strides[i] <= 0 || buf.strides[i] % buf.itemsize != 0) {
+                    return false;
+                }
+                strides[i] = (index_type) (buf.strides[i] / buf.itemsize);
+            }
+            value.emplace(ptr,
+                          typename Layout::template mapping<Extents>(Extents(extents), strides));
+        } else {
+            value.emplace(ptr, Extents(extents));
+        }
+        return true;
+    }
+
+    static constexpr auto name = const_name("Buffer[") + make_caster<value_type>::name
+                                 + const_name(", ") + const_name<rank>() + const_name("D]");
+    template <typename>
+    using cast_op_type = Mdspan;
+    explicit operator Mdspan() { return *value; }
+
+private:
+    static int layout_flags() {
+        if (std::is_same<Layout, std::layout_right>::value) {
+            return PyBUF_C_CONTIGUOUS;
+        }
+        if (std::is_same<Layout, std::layout_left>::value) {
+            return PyBUF_F_CONTIGUOUS;
+        }
+        return PyBUF_STRIDES;
+    }
+
+    buffer_info buf;
+    std::optional<Mdspan> value;
+};
+#    endif
+#endif
+
 PYBIND11_NAMESPACE_END(detail)
 
 inline std::ostream &operator<<(std::ostream &os, const handle &obj) {
@@ -15,6 +15,7 @@
 #include "operators.h"
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <type_traits>
 
@@ -123,6 +124,29 @@ void vector_if_equal_operator(enable_if_t<is_comparable<Vector>::value, Class_>
         "Return true the container contains ``x``");
 }
 
+// Appends the items of a generic Python iterable one at a time, leaving the vector unchanged if
+// one of them fails to convert
+template <typename Vector>
+void vector_extend_iterable(Vector &v, const iterable &it) {
+    using T = typename Vector::value_type;
+
+    const size_t old_size = v.size();
+    v.reserve(old_size + len_hint(it));
+    try {
+        for (handle h : it) {
+            v.push_back(h.cast<T>());
+        }
+    } catch (const cast_error &) {
+        v.erase(v.begin() + static_cast<typename Vector::difference_type>(old_size), v.end());
+        try {
+            v.shrink_to_fit();
+        } catch (const std::exception &) {
+            // Do nothing
+        }
+        throw;
+    }
+}
+
 // Vector modifiers -- requires a copyable vector_type:
 // (Technically, some of these (pop and __delitem__) don't actually require copyability, but it
 // seems silly to allow deletion but not insertion, so include them here too.)
@@ -169,27 +193,19 @@ void vector_modifiers(
 
     cl.def(
         "extend",
-        [](Vector &v, const iterable &it) {
-            const size_t old_size = v.size();
-            v.reserve(old_size + len_hint(it));
-            try {
-                for (handle h : it) {
-                    v.push_back(h.cast<T>());
-                }
-            } catch (const cast_error &) {
-                v.erase(v.begin() + static_cast<typename Vector::difference_type>(old_size),
-                        v.end());
-                try {
-                    v.shrink_to_fit();
-                } catch (const std::exception &) {
-                    // Do nothing
-                }
-                throw;
-            }
-        },
+        [](Vector &v, const iterable &it) { vector_extend_iterable(v, it); },
         arg("L"),
         "Extend the list by appending all the items in the given list");
 
+    cl.def(
+        "__iadd__",
+        [](const object &self, const object &other) {
+            self.attr("extend")(other);
+            return self;
+        },
+        arg("L"),
+        "Extend the list in place; equivalent to ``extend``");
+
     cl.def(
         "insert",
         [](Vector &v, DiffType i, const T &x) {
@@ -425,10 +441,77 @@ constexpr bool args_any_are_buffer() {
 // [workaround(intel)] Separate function required here
 // [workaround(msvc)] Can't use constexpr bool in return type
 
+// Returns true if `info` describes a 1D buffer whose elements can be copied directly into a
+// vector of T (matching item format and size, element-aligned stride)
+template <typename T>
+bool vector_buffer_compatible(const buffer_info &info) {
+    return info.ndim == 1 && info.strides[0] % static_cast<ssize_t>(sizeof(T)) == 0
+           && detail::compare_buffer_info<T>::compare(info)
+           && static_cast<ssize_t>(sizeof(T)) == info.itemsize;
+}
+
+template <typename T>
+void vector_buffer_check(const buffer_info &info) {
+    if (info.ndim != 1 || info.strides[0] % static_cast<ssize_t>(sizeof(T))) {
+        throw type_error("Only valid 1D buffers can be copied to a vector");
+    }
+    if (!detail::compare_buffer_info<T>::compare(info)
+        || (ssize_t) sizeof(T) != info.itemsize) {
+        throw type_error("Format mismatch (Python: " + info.format
+                         + " C++: " + format_descriptor<T>::format() + ")");
+    }
+}
+
+// Whether the memory described by a compatible buffer overlaps the storage of `v`
+template <typename Vector>
+bool vector_buffer_overlaps(const Vector &v, const buffer_info &info) {
+    using T = typename Vector::value_type;
+
+    const ssize_t n = info.shape[0];
+    if (n == 0 || v.empty()) {
+        return false;
+    }
+    const ssize_t step = info.strides[0] / static_cast<ssize_t>(sizeof(T));
+    const auto *p = static_cast<const T *>(info.ptr);
+    const T *first = step < 0 ? p + (n - 1) * step : p;
+    const T *last = step < 0 ? p + 1 : p + (n - 1) * step + 1;
+    return first < v.data() + v.size() && v.data() < last;
+}
+
+// Bulk-appends the contents of a compatible buffer (see vector_buffer_compatible) to a vector.
+// Contiguous sources are copied as one range (a memmove for trivially copyable types); strided
+// sources are copied element by element after a single reservation.
+template <typename Vector>
+void vector_append_buffer(Vector &v, const buffer_info &info) {
+    using T = typename Vector::value_type;
+
+    const T *p = static_cast<const T *>(info.ptr);
+    const ssize_t n = info.shape[0];
+    const ssize_t step = info.strides[0] / static_cast<ssize_t>(sizeof(T));
+    // The source may be a view of `v` itself (e.g. `v.extend(v)`), which vector::insert does not
+    // allow and which growing `v` would invalidate: copy it out first in that case.
+    if (vector_buffer_overlaps(v, info)) {
+        Vector tmp;
+        vector_append_buffer(tmp, info);
+        v.insert(v.end(), tmp.begin(), tmp.end());
+        return;
+    }
+    if (step == 1) {
+        v.insert(v.end(), p, p + n);
+        return;
+    }
+    v.reserve(v.size() + static_cast<size_t>(n));
+    for (ssize_t i = 0; i < n; ++i, p += step) {
+        v.push_back(*p);
+    }
+}
+
 // Add the buffer interface to a vector
 template <typename Vector, typename Class_, typename... Args>
 void vector_buffer_impl(Class_ &cl, std::true_type) {
     using T = typename Vector::value_type;
+    using SizeType = typename Vector::size_type;
+    using DiffType = typename Vector::difference_type;
 
     static_assert(vector_has_data_and_format<Vector>::value,
                   "There is not an appropriate format descriptor for this vector");
@@ -448,29 +531,72 @@ void vector_buffer_impl(Class_ &cl, std::true_type) {
 
     cl.def(init([](const buffer &buf) {
         auto info = buf.request();
-        if (info.ndim != 1 || info.strides[0] % static_cast<ssize_t>(sizeof(T))) {
-            throw type_error("Only valid 1D buffers can be copied to a vector");
-        }
-        if (!detail::compare_buffer_info<T>::compare(info)
-            || (ssize_t) sizeof(T) != info.itemsize) {
-            throw type_error("Format mismatch (Python: " + info.format
-                             + " C++: " + format_descriptor<T>::format() + ")");
-        }
-
-        T *p = static_cast<T *>(info.ptr);
-        ssize_t step = info.strides[0] / static_cast<ssize_t>(sizeof(T));
-        T *end = p + info.shape[0] * step;
-        if (step == 1) {
-            return Vector(p, end);
-        }
+        vector_buffer_check<T>(info);
         Vector vec;
-        vec.reserve((size_t) info.shape[0]);
-        for (; p != end; p += step) {
-            vec.push_back(*p);
-        }
+        vector_append_buffer(vec, info);
         return vec;
     }));
 
+    // Registered ahead of the generic iterable overloads from vector_modifiers, so that buffer
+    // sources with a matching format are copied in bulk instead of element by element.
+    cl.def(
+        "extend",
+        [](Vector &v, const buffer &buf) {
+            auto info = buf.request();
+            if (vector_buffer_compatible<T>(info)) {
+                vector_append_buffer(v, info);
+                return;
+            }
+            // Formats that need a per-element conversion (e.g. int32 into a vector of int64)
+            if (!isinstance<iterable>(buf)) {
+                vector_buffer_check<T>(info);
+            }
+            vector_extend_iterable(v, reinterpret_borrow<iterable>(buf));
+        },
+        arg("L"),
+        "Extend the list by appending all the items in the given buffer");
+
+    cl.def(
+        "__setitem__",
+        [](Vector &v, const slice &slice, const buffer &buf) {
+            size_t start = 0, stop = 0, step = 0, slicelength = 0;
+            if (!slice.compute(v.size(), &start, &stop, &step, &slicelength)) {
+                throw error_already_set();
+            }
+
+            auto info = buf.request();
+            // Copy through a temporary if the source is a view of `v` itself, or if its format
+            // needs a per-element conversion (as in extend)
+            Vector tmp;
+            const bool compatible = vector_buffer_compatible<T>(info);
+            const bool use_tmp = !compatible || vector_buffer_overlaps(v, info);
+            if (!compatible) {
+                if (!isinstance<iterable>(buf)) {
+                    vector_buffer_check<T>(info);
+                }
+                vector_extend_iterable(tmp, reinterpret_borrow<iterable>(buf));
+            } else if (use_tmp) {
+                vector_append_buffer(tmp, info);
+            }
+            if (slicelength != (use_tmp ? tmp.size() : static_cast<size_t>(info.shape[0]))) {
+                throw std::runtime_error(
+                    "Left and right hand size of slice assignment have different sizes!");
+            }
+
+            const T *src = use_tmp ? tmp.data() : static_cast<const T *>(info.ptr);
+            const ssize_t src_step
+                = use_tmp ? 1 : info.strides[0] / static_cast<ssize_t>(sizeof(T));
+            if (step == 1 && src_step == 1) {
+                std::copy(src, src + slicelength, v.begin() + static_cast<DiffType>(start));
+                return;
+            }
+            for (SizeType i = 0; i < slicelength; ++i, src += src_step) {
+                v[start] = *src;
+                start += step;
+            }
+        },
+        "Assign list elements from a buffer using a slice object");
+
     return;
 }
 
@@ -483,6 +609,106 @@ void vector_buffer(Class_ &cl) {
         cl, detail::any_of<std::is_same<Args, buffer_protocol>...>{});
 }
 
+// Binary pickling of containers of arithmetic types: each array of elements is stored as a
+// (format, itemsize, byteorder, data) tuple, where data is a bytes object holding the raw
+// element storage. Restoring it takes a single allocation and copy (plus a byte swap if the
+// pickle was written on a machine of the opposite endianness).
+inline const char *native_byteorder() {
+    const uint16_t probe = 1;
+    unsigned char first = 0;
+    std::memcpy(&first, &probe, 1);
+    return first == 1 ? "little" : "big";
+}
+
+// Returns an uninitialized bytes object large enough for `n` elements of type T
+template <typename T>
+bytes pod_array_bytes(size_t n, char *&data) {
+    auto result = reinterpret_steal<bytes>(
+        PyBytes_FromStringAndSize(nullptr, static_cast<ssize_t>(n * sizeof(T))));
+    if (!result) {
+        throw error_already_set();
+    }
+    data = PyBytes_AS_STRING(result.ptr());
+    return result;
+}
+
+template <typename T>
+tuple pod_array_state(const bytes &data) {
+    return pybind11::make_tuple(
+        format_descriptor<T>::format(), sizeof(T), native_byteorder(), data);
+}
+
+// Reads an array state written by pod_array_state<T>, returning the number of elements
+template <typename T>
+size_t pod_array_load(const handle &state, const char *&data, bool &swap) {
+    auto t = reinterpret_borrow<tuple>(state);
+    if (!isinstance<tuple>(state) || t.size() != 4 || !isinstance<bytes>(t[3])) {
+        throw value_error("Invalid pickle state");
+    }
+    if (t[0].cast<std::string>() != format_descriptor<T>::format()
+        || t[1].cast<size_t>() != sizeof(T)) {
+        throw value_error("Pickled data has an incompatible element type (format: "
+                          + t[0].cast<std::string>()
+                          + ", C++: " + format_descriptor<T>::format() + ")");
+    }
+    swap = t[2].cast<std::string>() != native_byteorder();
+    PyObject *raw = PyTuple_GET_ITEM(t.ptr(), 3);
+    auto nbytes = static_cast<size_t>(PyBytes_GET_SIZE(raw));
+    if (nbytes % sizeof(T) != 0) {
+        throw value_error("Invalid pickle state");
+    }
+    data = PyBytes_AS_STRING(raw);
+    return nbytes / sizeof(T);
+}
+
+template <typename T>
+T pod_array_get(const char *data, size_t i, bool swap) {
+    T value;
+    std::memcpy(&value, data + i * sizeof(T), sizeof(T));
+    if (swap) {
+        auto *b = reinterpret_cast<unsigned char *>(&value);
+        std::reverse(b, b + sizeof(T));
+    }
+    return value;
+}
+
+template <typename, typename, typename... Args>
+void vector_if_arithmetic(const Args &...) {}
+
+template <typename Vector, typename Class_>
+void vector_if_arithmetic(enable_if_t<std::is_arithmetic<typename Vector::value_type>::value
+                                          && vector_has_data_and_format<Vector>::value,
+                                      Class_> &cl) {
+    using T = typename Vector::value_type;
+
+    cl.def(pickle(
+        [](const Vector &v) {
+            char *data = nullptr;
+            auto raw = pod_array_bytes<T>(v.size(), data);
+            if (!v.empty()) {
+                std::memcpy(data, v.data(), v.size() * sizeof(T));
+            }
+            return pod_array_state<T>(raw);
+        },
+        [](const tuple &state) {
+            const char *data = nullptr;
+            bool swap = false;
+            size_t n = pod_array_load<T>(state, data, swap);
+            Vector v(n);
+            if (!swap) {
+                if (n != 0) {
+                    // `v` is still private and `state` keeps the source alive
+                    detail::copy_bytes(v.data(), data, n * sizeof(T));
+                }
+            } else {
+                for (size_t i = 0; i < n; ++i) {
+                    v[i] = pod_array_get<T>(data, i, swap);
+                }
+            }
+            return v;
+        }));
+}
+
 PYBIND11_NAMESPACE_END(detail)
 
 //
@@ -527,6 +753,9 @@ class_<Vector, holder_type> bind_vector(handle scope, std::string const &name, A
 
     cl.def("__len__", &Vector::size);
 
+    // Binary pickling for vectors of arithmetic types
+    detail::vector_if_arithmetic<Vector, Class_>(cl);
+
 #if 0
     // C++ style functions deprecated, leaving it here as an example
     cl.def(init<size_type>());
@@ -581,43 +810,192 @@ template <typename, typename, typename... Args>
 void map_if_insertion_operator(const Args &...) {}
 template <typename, typename, typename... Args>
 void map_assignment(const Args &...) {}
+template <typename, typename, typename... Args>
+void map_if_copy_constructible(const Args &...) {}
+template <typename, typename, typename... Args>
+void map_if_arithmetic(const Args &...) {}
+
+// Insert-or-assign when copy-assignable: just copy the value
+template <typename Map>
+void map_set_item(enable_if_t<is_copy_assignable<typename Map::mapped_type>::value, Map> &m,
+                  const typename Map::key_type &k,
+                  const typename Map::mapped_type &v) {
+    auto it = m.find(k);
+    if (it != m.end()) {
+        it->second = v;
+    } else {
+        m.emplace(k, v);
+    }
+}
 
-// Map assignment when copy-assignable: just copy the value
+// Not copy-assignable, but still copy-constructible: we can update the value by erasing and
+// reinserting
+template <typename Map>
+void map_set_item(enable_if_t<!is_copy_assignable<typename Map::mapped_type>::value
+                                  && is_copy_constructible<typename Map::mapped_type>::value,
+                              Map> &m,
+                  const typename Map::key_type &k,
+                  const typename Map::mapped_type &v) {
+    // We can't use m[k] = v; because value type might not be default constructable
+    auto r = m.emplace(k, v);
+    if (!r.second) {
+        // value type is not copy assignable so the only way to insert it is to erase it
+        // first...
+        m.erase(r.first);
+        m.emplace(k, v);
+    }
+}
+
+// Map assignment, provided when the value can be updated through map_set_item: __setitem__
+// and a bulk dict-style update()
 template <typename Map, typename Class_>
-void map_assignment(
-    enable_if_t<is_copy_assignable<typename Map::mapped_type>::value, Class_> &cl) {
+void map_assignment(enable_if_t<is_copy_assignable<typename Map::mapped_type>::value
+                                    || is_copy_constructible<typename Map::mapped_type>::value,
+                                Class_> &cl) {
     using KeyType = typename Map::key_type;
     using MappedType = typename Map::mapped_type;
 
     cl.def("__setitem__", [](Map &m, const KeyType &k, const MappedType &v) {
-        auto it = m.find(k);
-        if (it != m.end()) {
-            it->second = v;
-        } else {
-            m.emplace(k, v);
-        }
+        map_set_item<Map>(m, k, v);
     });
+
+    cl.def(
+        "update",
+        [](Map &m, const Map &other) {
+            if (&m == &other) {
+                return;
+            }
+            for (auto const &kv : other) {
+                map_set_item<Map>(m, kv.first, kv.second);
+            }
+        },
+        arg("other"),
+        "Update the map with the items of another map, overwriting existing keys");
+
+    // Loads each key and value straight from the dict's items, without going through an
+    // intermediate pair or a Python-level __setitem__ call
+    cl.def(
+        "update",
+        [](Map &m, const dict &other) {
+            for (auto item : other) {
+                make_caster<KeyType> key_conv;
+                make_caster<MappedType> value_conv;
+                load_type(key_conv, item.first);
+                load_type(value_conv, item.second);
+                map_set_item<Map>(
+                    m, cast_op<const KeyType &>(key_conv), cast_op<const MappedType &>(value_conv));
+            }
+        },
+        arg("other"),
+        "Update the map with the items of a dict, overwriting existing keys");
+
+    // Anything else ``dict()`` accepts: mappings and iterables of key/value pairs
+    cl.def(
+        "update",
+        [](const object &self, const object &other) { self.attr("update")(dict(other)); },
+        arg("other"),
+        "Update the map with the items of a mapping or an iterable of key/value pairs");
 }
 
-// Not copy-assignable, but still copy-constructible: we can update the value by erasing and
-// reinserting
+// Export to a Python dict; the values are copied, so this requires a copyable value type
 template <typename Map, typename Class_>
-void map_assignment(enable_if_t<!is_copy_assignable<typename Map::mapped_type>::value
-                                    && is_copy_constructible<typename Map::mapped_type>::value,
-                                Class_> &cl) {
+void map_if_copy_constructible(
+    enable_if_t<is_copy_constructible<typename Map::mapped_type>::value, Class_> &cl) {
     using KeyType = typename Map::key_type;
     using MappedType = typename Map::mapped_type;
 
-    cl.def("__setitem__", [](Map &m, const KeyType &k, const MappedType &v) {
-        // We can't use m[k] = v; because value type might not be default constructable
-        auto r = m.emplace(k, v);
-        if (!r.second) {
-            // value type is not copy assignable so the only way to insert it is to erase it
-            // first...
-            m.erase(r.first);
-            m.emplace(k, v);
-        }
-    });
+    cl.def(
+        "to_dict",
+        [](const Map &m) {
+            dict d;
+            for (auto const &kv : m) {
+                auto key = reinterpret_steal<object>(
+                    make_caster<KeyType>::cast(kv.first, return_value_policy::copy, handle()));
+                auto value = reinterpret_steal<object>(
+                    make_caster<MappedType>::cast(kv.second, return_value_policy::copy, handle()));
+                if (!key || !value || PyDict_SetItem(d.ptr(), key.ptr(), value.ptr()) != 0) {
+                    throw error_already_set();
+                }
+            }
+            return d;
+        },
+        "Return a new dict holding a copy of the items of the map");
+}
+
+template <typename Map>
+auto map_reserve(Map &m, size_t n) -> decltype(m.reserve(n)) {
+    return m.reserve(n);
+}
+template <typename Map>
+void map_reserve(Map &, ...) {}
+
+// Binary pickling (see pod_array_state) and columnar export of maps of arithmetic types, as a
+// pair of NumPy arrays. The arrays are allocated with ``numpy.empty`` and filled through the
+// buffer protocol, so this does not depend on pybind11/numpy.h.
+template <typename Map, typename Class_>
+void map_if_arithmetic(
+    enable_if_t<std::is_arithmetic<remove_cvref_t<typename Map::key_type>>::value
+                    && std::is_arithmetic<remove_cvref_t<typename Map::mapped_type>>::value,
+                Class_> &cl) {
+    using KeyType = remove_cvref_t<typename Map::key_type>;
+    using MappedType = remove_cvref_t<typename Map::mapped_type>;
+
+    cl.def(pickle(
+        [](const Map &m) {
+            char *keys = nullptr;
+            char *values = nullptr;
+            auto keys_raw = pod_array_bytes<KeyType>(m.size(), keys);
+            auto values_raw = pod_array_bytes<MappedType>(m.size(), values);
+            for (auto const &kv : m) {
+                std::memcpy(keys, &kv.first, sizeof(KeyType));
+                std::memcpy(values, &kv.second, sizeof(MappedType));
+                keys += sizeof(KeyType);
+                values += sizeof(MappedType);
+            }
+            return make_tuple(pod_array_state<KeyType>(keys_raw),
+                              pod_array_state<MappedType>(values_raw));
+        },
+        [](const tuple &state) {
+            if (state.size() != 2) {
+                throw value_error("Invalid pickle state");
+            }
+            const char *keys = nullptr;
+            const char *values = nullptr;
+            bool keys_swap = false;
+            bool values_swap = false;
+            size_t n = pod_array_load<KeyType>(state[0], keys, keys_swap);
+            if (pod_array_load<MappedType>(state[1], values, values_swap) != n) {
+                throw value_error("Invalid pickle state");
+            }
+            Map m;
+            map_reserve(m, n);
+            // The items were written in iteration order, which makes the end a good hint for
+            // ordered maps
+            for (size_t i = 0; i < n; ++i) {
+                m.emplace_hint(m.end(),
+                               pod_array_get<KeyType>(keys, i, keys_swap),
+                               pod_array_get<MappedType>(values, i, values_swap));
+            }
+            return m;
+        }));
+
+    cl.def(
+        "to_arrays",
+        [](const Map &m) {
+            auto empty = module_::import("numpy").attr("empty");
+            auto keys = empty(m.size(), arg("dtype") = format_descriptor<KeyType>::format());
+            auto values = empty(m.size(), arg("dtype") = format_descriptor<MappedType>::format());
+            auto keys_info = reinterpret_borrow<buffer>(keys).request(true);
+            auto values_info = reinterpret_borrow<buffer>(values).request(true);
+            auto *kp = static_cast<KeyType *>(keys_info.ptr);
+            auto *vp = static_cast<MappedType *>(values_info.ptr);
+            for (auto const &kv : m) {
+                *kp++ = kv.first;
+                *vp++ = kv.second;
+            }
+            return make_tuple(keys, values);
+        },
+        "Return the keys and the values of the map as two NumPy arrays, in iteration order");
 }
 
 template <typename Map, typename Class_>
@@ -835,6 +1213,10 @@ class_<Map, holder_type> bind_map(handle scope, const std::string &name, Args &&
     // Assignment provided only if the type is copyable
     detail::map_assignment<Map, Class_>(cl);
 
+    // Bulk export to a dict (copyable values) and to NumPy arrays (arithmetic types)
+    detail::map_if_copy_constructible<Map, Class_>(cl);
+    detail::map_if_arithmetic<Map, Class_>(cl);
+
     cl.def("__delitem__", [](Map &m, const KeyType &k) {
         auto it = m.find(k);
         if (it == m.end()) {
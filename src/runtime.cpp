@@ -0,0 +1,8 @@
+// Copyright (c) 2023 The pybind Community.
+
+// Compiled copy of the non-template parts of pybind11 (see PYBIND11_RUNTIME_INLINE in
+// detail/common.h) that extension modules share when they link to pybind11::runtime.
+
+#define PYBIND11_RUNTIME_BUILD
+
+#include <pybind11/pybind11.h>
@@ -256,4 +256,20 @@ TEST_SUBMODULE(buffers, m) {
         });
 
     m.def("get_buffer_info", [](const py::buffer &buffer) { return buffer.request(); });
+
+    m.def("get_buffer_view", [](const py::buffer &buffer) {
+        auto view = buffer.view();
+        py::list shape, strides;
+        for (py::ssize_t i = 0; i < view.ndim(); ++i) {
+            shape.append(view.shape(i));
+            strides.append(view.strides(i));
+        }
+        return py::make_tuple(view.itemsize(),
+                              view.size(),
+                              view.format(),
+                              view.ndim(),
+                              shape,
+                              strides,
+                              view.readonly());
+    });
 }
@@ -219,3 +219,32 @@ def test_ctypes_from_buffer():
         assert cinfo.shape == pyinfo.shape
         assert cinfo.strides == pyinfo.strides
         assert not cinfo.readonly
+
+
+def test_buffer_view():
+    def from_info(obj):
+        info = m.get_buffer_info(obj)
+        return (
+            info.itemsize,
+            info.size,
+            info.format,
+            info.ndim,
+            info.shape,
+            info.strides,
+            info.readonly,
+        )
+
+    arr = np.arange(24, dtype=np.float64).reshape(4, 6)
+    for obj in (
+        arr,
+        arr[::2, ::3],
+        arr.T,
+        memoryview(b"abc"),
+        bytearray(5),
+        ((ctypes.c_int * 3) * 2)(),
+        m.Matrix(3, 2),
+    ):
+        assert m.get_buffer_view(obj) == from_info(obj)
+
+    with pytest.raises(TypeError):
+        m.get_buffer_view(42)
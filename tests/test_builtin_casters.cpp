@@ -140,6 +140,13 @@ TEST_SUBMODULE(builtin_casters, m) {
     m.def("strlen", [](char *s) { return strlen(s); });
     m.def("string_length", [](const std::string &s) { return s.length(); });
 
+    // test_interned_str
+    m.def("interned_label", [](int i) -> py::interned_str {
+        static const char *labels[] = {"even", "odd", "\u00e9t\u00e9 \U0001f382"};
+        return i < 0 ? labels[2] : labels[i % 2];
+    });
+    m.def("interned_roundtrip", [](const py::interned_str &s) { return s; });
+
 #ifdef PYBIND11_HAS_U8STRING
     m.attr("has_u8string") = true;
     m.def("good_utf8_u8string", []() {
@@ -142,6 +142,22 @@ def test_bytearray_to_string():
     assert m.string_length(bytearray(b"\x80")) == 1
 
 
+def test_interned_str(doc):
+    assert m.interned_label(0) == "even"
+    assert m.interned_label(1) == "odd"
+    # Repeated values are the same (interned) Python object
+    assert m.interned_label(3) is m.interned_label(5)
+    assert m.interned_label(3) is sys.intern("".join(["o", "dd"]))
+    assert m.interned_label(-1) == "\u00e9t\u00e9 \U0001f382"
+    assert m.interned_label(-1) is m.interned_label(-1)
+
+    key = "".join(["dyn", "amic"])
+    assert m.interned_roundtrip(key) == key
+    assert m.interned_roundtrip(key) is m.interned_roundtrip(key)
+    assert m.interned_roundtrip(b"raw") == "raw"
+    assert doc(m.interned_roundtrip) == "interned_roundtrip(arg0: str) -> str"
+
+
 @pytest.mark.skipif(not hasattr(m, "has_string_view"), reason="no <string_view>")
 def test_string_view(capture):
     """Tests support for C++17 string_view arguments and return values"""
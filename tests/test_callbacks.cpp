@@ -264,17 +264,12 @@ TEST_SUBMODULE(callbacks, m) {
     // This capsule should be detected by our code as foreign and not inspected as the pointers
     // shouldn't match
     constexpr const char *rec_capsule_name
-        = pybind11::detail::internals_function_record_capsule_name;
+        = pybind11::detail::function_record_capsule_name_v2;
     py::capsule rec_capsule(std::malloc(1), [](void *data) { std::free(data); });
     rec_capsule.set_name(rec_capsule_name);
     m.add_object("custom_function", PyCFunction_New(custom_def, rec_capsule.ptr()));
 
-    // This test requires a new ABI version to pass
-#if PYBIND11_INTERNALS_VERSION > 4
-    // rec_capsule with nullptr name
+    // rec_capsule with nullptr name, as used by function records of internals version 4 modules
     py::capsule rec_capsule2(std::malloc(1), [](void *data) { std::free(data); });
     m.add_object("custom_function2", PyCFunction_New(custom_def, rec_capsule2.ptr()));
-#else
-    m.add_object("custom_function2", py::none());
-#endif
 }
@@ -52,8 +52,25 @@ void bind_empty0(py::module_ &m) {
 }
 
 } // namespace pr4220_tripped_over_this
+
+struct FixedSize {
+    char data[1000] = {};
+};
+struct OwnsBuffer {
+    explicit OwnsBuffer(size_t n) : buffer(n) {}
+    std::vector<char> buffer;
+};
 } // namespace test_class
 
+namespace PYBIND11_NAMESPACE {
+template <>
+struct sizeof_hook<test_class::OwnsBuffer> {
+    static size_t owned_bytes(const test_class::OwnsBuffer &value) {
+        return value.buffer.capacity();
+    }
+};
+} // namespace PYBIND11_NAMESPACE
+
 TEST_SUBMODULE(class_, m) {
     m.def("obj_class_name", [](py::handle obj) { return py::detail::obj_class_name(obj.ptr()); });
 
@@ -440,6 +457,53 @@ TEST_SUBMODULE(class_, m) {
         .def(py::init<std::vector<int>>())
         .def_readonly("vec", &NoBraceInitialization::vec);
 
+    // test_implicit_conversion_direct
+    struct ImplicitTarget {
+        explicit ImplicitTarget(const UserType &u) : value(u.value()) {}
+        explicit ImplicitTarget(const std::tuple<double, double> &t)
+            : value(std::get<0>(t) + std::get<1>(t)) {}
+        double value;
+        bool via_init = false;
+    };
+    struct SharedImplicitTarget {
+        explicit SharedImplicitTarget(const UserType &u) : value(u.value()) {}
+        int value;
+        bool via_init = false;
+    };
+    // The Python constructors mark the objects they create, so the tests can tell whether a
+    // conversion went through a Python instance
+    py::class_<ImplicitTarget>(m, "ImplicitTarget")
+        .def(py::init([](const UserType &u) {
+            ImplicitTarget t(u);
+            t.via_init = true;
+            return t;
+        }))
+        .def(py::init([](const std::tuple<double, double> &a) {
+            ImplicitTarget t(a);
+            t.via_init = true;
+            return t;
+        }));
+    py::implicitly_convertible<UserType, ImplicitTarget>(py::direct_conversion());
+    // Unregistered sources always go through Python, so the C++ constructor isn't used
+    py::implicitly_convertible<std::tuple<double, double>, ImplicitTarget>();
+    py::class_<SharedImplicitTarget, std::shared_ptr<SharedImplicitTarget>>(
+        m, "SharedImplicitTarget")
+        .def(py::init([](const UserType &u) {
+            auto t = std::make_shared<SharedImplicitTarget>(u);
+            t->via_init = true;
+            return t;
+        }));
+    py::implicitly_convertible<UserType, SharedImplicitTarget>(py::direct_conversion());
+    m.def("implicit_target",
+          [](const ImplicitTarget &t) { return py::make_tuple(t.value, t.via_init); });
+    m.def("shared_implicit_target", [](const SharedImplicitTarget &t) {
+        return py::make_tuple(t.value, t.via_init);
+    });
+    m.def("direct_conversion_from_unregistered", []() {
+        py::implicitly_convertible<std::tuple<double, double>, ImplicitTarget>(
+            py::direct_conversion());
+    });
+
     // test_reentrant_implicit_conversion_failure
     // #1035: issue with runaway reentrant implicit conversion
     struct BogusImplicitConversion {
@@ -554,6 +618,41 @@ TEST_SUBMODULE(class_, m) {
         py::class_<OtherDuplicateNested>(gt, "YetAnotherDuplicateNested");
     });
 
+    // test_type_registered_late
+    struct RegisteredLate {
+        int value = 42;
+    };
+    m.def("make_registered_late", []() { return RegisteredLate{}; });
+    m.def("register_late", [](const py::module_ &m) {
+        py::class_<RegisteredLate>(m, "RegisteredLate")
+            .def_readonly("value", &RegisteredLate::value);
+    });
+
+    // test_polymorphic_type_registered_late
+    struct LateBase {
+        virtual ~LateBase() = default;
+    };
+    struct LateDerived : LateBase {};
+    py::class_<LateBase>(m, "LateBase");
+    m.def("make_late_derived", []() -> LateBase * { return new LateDerived(); });
+    m.def("register_late_derived",
+          [](const py::module_ &m) { py::class_<LateDerived, LateBase>(m, "LateDerived"); });
+
+    // test_sizeof
+    py::class_<test_class::FixedSize>(m, "FixedSize").def(py::init<>());
+    py::class_<test_class::OwnsBuffer>(m, "OwnsBuffer").def(py::init<size_t>());
+    m.def(
+        "fixed_size_reference",
+        []() {
+            static test_class::FixedSize value;
+            return &value;
+        },
+        py::return_value_policy::reference);
+
+    // test_live_instances
+    m.def("track_live_instances", &py::track_live_instances, py::arg("enable") = true);
+    m.def("live_instances", &py::live_instances);
+
     test_class::pr4220_tripped_over_this::bind_empty0(m);
 }
 
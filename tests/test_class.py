@@ -262,6 +262,25 @@ def test_implicit_conversion_life_support():
     assert "outside a bound function" in m.implicitly_convert_variable_fail(UserType(5))
 
 
+def test_implicit_conversion_direct():
+    # Constructed directly in C++, without a temporary Python instance
+    assert m.implicit_target(UserType(5)) == (5.0, False)
+    # Unregistered source types are always converted by the Python constructor
+    assert m.implicit_target((1.5, 2.0)) == (3.5, True)
+    # Alternating source types pick the right route each time
+    for _ in range(2):
+        assert m.implicit_target((1.0, 1.0)) == (2.0, True)
+        assert m.implicit_target(UserType(7)) == (7.0, False)
+    with pytest.raises(TypeError):
+        m.implicit_target((1.0, 2.0, 3.0))
+
+    # Holders other than unique_ptr still go through the Python constructor
+    assert m.shared_implicit_target(UserType(3)) == (3, True)
+
+    with pytest.raises(RuntimeError, match="Unable to find type std::tuple"):
+        m.direct_conversion_from_unregistered()
+
+
 def test_operator_new_delete(capture):
     """Tests that class-specific operator new/delete functions are invoked"""
 
@@ -483,3 +502,70 @@ def test_pr4220_tripped_over_this():
         m.Empty0().get_msg()
         == "This is really only meant to exercise successful compilation."
     )
+
+
+def test_type_registered_late():
+    import types
+
+    # A failed lookup must not stick once the type gets registered, and vice versa
+    with pytest.raises(TypeError):
+        m.make_registered_late()
+    scope = types.ModuleType("scope")
+    m.register_late(scope)
+    for _ in range(2):
+        assert m.make_registered_late().value == 42
+    del scope
+    pytest.gc_collect()
+    with pytest.raises(TypeError):
+        m.make_registered_late()
+
+
+def test_polymorphic_type_registered_late():
+    import types
+
+    # The most-derived type lookup is cached, but must follow registration changes
+    for _ in range(2):
+        assert type(m.make_late_derived()) is m.LateBase
+    scope = types.ModuleType("scope")
+    m.register_late_derived(scope)
+    for _ in range(2):
+        assert type(m.make_late_derived()) is scope.LateDerived
+    del scope
+    pytest.gc_collect()
+    assert type(m.make_late_derived()) is m.LateBase
+
+
+def test_sizeof():
+    import sys
+
+    obj = m.FixedSize()
+    # The C++ value owned by the instance is included, on top of the Python object
+    assert obj.__sizeof__() >= object.__sizeof__(obj) + 1000
+    assert sys.getsizeof(obj) >= obj.__sizeof__()
+    # ... but not a value that is only referenced
+    assert m.fixed_size_reference().__sizeof__() < obj.__sizeof__()
+
+    # sizeof_hook adds the heap memory owned by the value
+    small, large = m.OwnsBuffer(0), m.OwnsBuffer(4096)
+    assert large.__sizeof__() - small.__sizeof__() == 4096
+
+
+def test_live_instances():
+    # Nothing is counted until tracking is enabled
+    obj = m.FixedSize()
+    assert m.FixedSize not in m.live_instances()
+    del obj
+
+    m.track_live_instances()
+    try:
+        objs = [m.FixedSize() for _ in range(3)]
+        assert m.live_instances()[m.FixedSize] == (3, 3000)
+        # Instances that only reference a C++ value don't add to the size
+        ref = m.fixed_size_reference()
+        assert m.live_instances()[m.FixedSize] == (4, 3000)
+        del objs, ref
+        pytest.gc_collect()
+        assert m.FixedSize not in m.live_instances()
+    finally:
+        m.track_live_instances(False)
+    assert not m.live_instances()
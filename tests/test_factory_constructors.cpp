@@ -225,6 +225,7 @@ TEST_SUBMODULE(factory_constructors, m) {
     MAKE_TAG_TYPE(alias);
     MAKE_TAG_TYPE(unaliasable);
     MAKE_TAG_TYPE(mixed);
+    MAKE_TAG_TYPE(placement);
 
     // test_init_factory_basic, test_bad_type
     py::class_<TestFactory1>(m, "TestFactory1")
@@ -294,6 +295,8 @@ TEST_SUBMODULE(factory_constructors, m) {
         .def(py::init([](base_tag, pointer_tag, int i) { return new TestFactory6(i); }))
         .def(py::init(
             [](base_tag, alias_tag, pointer_tag, int i) { return (TestFactory6 *) new PyTF6(i); }))
+        .def(py::init_placement(
+            [](void *storage, placement_tag, int i) { new (storage) TestFactory6(i); }))
 
         .def("get", &TestFactory6::get)
         .def("has_alias", &TestFactory6::has_alias)
@@ -303,6 +306,18 @@ TEST_SUBMODULE(factory_constructors, m) {
         .def_static(
             "get_alias_cstats", &ConstructorStats::get<PyTF6>, py::return_value_policy::reference);
 
+    // test_init_placement
+    struct NoMovePlacement {
+        explicit NoMovePlacement(int v) : value(v) {}
+        NoMovePlacement(NoMovePlacement &&) = delete;
+        NoMovePlacement(const NoMovePlacement &) = delete;
+        int value;
+    };
+    py::class_<NoMovePlacement>(m, "NoMovePlacement")
+        .def(py::init_placement(
+            [](void *storage, placement_tag, int v) { new (storage) NoMovePlacement(v); }))
+        .def_readonly("value", &NoMovePlacement::value);
+
     // test_init_factory_dual
     // Separate alias constructor testing
     py::class_<TestFactory7, PyTF7, std::shared_ptr<TestFactory7>>(m, "TestFactory7")
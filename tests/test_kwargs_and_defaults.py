@@ -53,6 +53,33 @@ def test_named_arguments():
     assert m.kw_func_udl_z(x=5) == "x=5, y=0"
 
 
+def test_keyword_matching():
+    # Keys built at runtime are not interned, so they are matched by value
+    x, y = "".join(["x"]), "".join(["y"])
+    assert m.kw_func1(**{y: 10, x: 5}) == "x=5, y=10"
+    assert m.kw_func2(**{y: 10}) == "x=100, y=10"
+
+    # Only the keyword arguments that were not matched reach `py::kwargs`, and the caller's
+    # dict is left untouched
+    mpakd = m.mixed_plus_args_kwargs_defaults
+    kwargs = {"j": 2.5, "k": 3}
+    assert mpakd(**kwargs) == (1, 2.5, (), {"k": 3})
+    assert kwargs == {"j": 2.5, "k": 3}
+    assert mpakd(i=7, j=2.5) == (7, 2.5, (), {})
+    assert mpakd(7, k=3) == (7, 3.14159, (), {"k": 3})
+
+
+def test_positional_call():
+    # A single overload given exactly its positional arguments bypasses overload resolution
+    assert m.kw_func1(5, 10) == "x=5, y=10"
+    with pytest.raises(TypeError) as excinfo:
+        m.kw_func1(5, "10")
+    assert "Invoked with: 5, '10'" in str(excinfo.value)
+    # ... but not once another overload has been chained onto the function
+    assert isinstance(m.arg_refcount_h(1), int)
+    assert isinstance(m.arg_refcount_h(1, 2, 3), int)
+
+
 def test_arg_and_kwargs():
     args = "arg1_value", "arg2_value", 3
     assert m.args_function(*args) == args
@@ -95,6 +95,29 @@ def test_copy_method():
     assert a.value == 42
 
 
+@pytest.mark.skipif("env.PYPY")
+def test_method_descriptor():
+    descr = m.ExampleMandA.__dict__["add6"]
+    assert type(descr).__name__ == "pybind11_method"
+    assert m.ExampleMandA.add6 is descr
+    assert repr(descr) == "<pybind11_method 'add6'>"
+    assert descr.__name__ == "add6"
+    assert descr.__module__ == "pybind11_tests.methods_and_attributes"
+    assert descr.__doc__.startswith("add6(self: ")
+
+    # `a.add6(...)` skips the bound method, but it can still be created explicitly
+    a = m.ExampleMandA(1)
+    a.add6(2)
+    bound = a.add6
+    assert bound.__self__ is a
+    assert bound.__func__ is descr.__func__
+    bound(3)
+    descr(a, 4)
+    assert a.value == 10
+    with pytest.raises(TypeError):
+        a.add6(other=5)
+
+
 def test_properties():
     instance = m.TestProperties()
 
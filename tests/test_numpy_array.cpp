@@ -12,7 +12,10 @@
 
 #include "pybind11_tests.h"
 
+#include <algorithm>
+#include <bitset>
 #include <cstdint>
+#include <memory>
 #include <utility>
 
 // Size / dtype checks.
@@ -159,6 +162,35 @@ py::handle auxiliaries(T &&r, T2 &&r2) {
 // note: declaration at local scope would create a dangling reference!
 static int data_i = 42;
 
+// Stateful allocator for test_mem_handler
+struct AllocationCounter {
+    std::size_t allocations = 0;
+    std::size_t live_bytes = 0;
+};
+
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    explicit CountingAllocator(AllocationCounter *counter) : counter(counter) {}
+    template <typename U>
+    explicit CountingAllocator(const CountingAllocator<U> &other) : counter(other.counter) {}
+
+    T *allocate(std::size_t n) {
+        ++counter->allocations;
+        counter->live_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) {
+        counter->live_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    AllocationCounter *counter;
+};
+
+static AllocationCounter mem_handler_counter;
+
 TEST_SUBMODULE(numpy_array, sm) {
     try {
         py::module_::import("numpy");
@@ -549,4 +581,48 @@ TEST_SUBMODULE(numpy_array, sm) {
 
     sm.def("return_array_pyobject_ptr_from_list",
            [](const py::list &objs) -> py::array_t<PyObject *> { return objs; });
+
+    // test_nested_vectors
+    sm.def("nested_as_ndarray", [](std::size_t rows, std::size_t cols) {
+        std::vector<std::vector<double>> v(rows, std::vector<double>(cols));
+        for (std::size_t r = 0; r < rows; ++r) {
+            for (std::size_t c = 0; c < cols; ++c) {
+                v[r][c] = static_cast<double>(r * 10 + c);
+            }
+        }
+        return py::as_ndarray(std::move(v));
+    });
+    sm.def("ragged_as_ndarray",
+           []() { return py::as_ndarray(std::vector<std::vector<int>>{{1, 2}, {3}}); });
+    sm.def("vector_as_ndarray", []() { return py::as_ndarray(std::vector<float>{1, 2}); });
+    sm.def("echo_nested", [](const std::vector<std::vector<double>> &v) { return v; });
+
+    // test_bitsets
+    sm.def("echo_bitset", [](const std::bitset<70> &b) { return b; });
+    sm.def("bitset_count", [](const std::bitset<13> &b) { return b.count(); });
+    sm.def("mask_count", [](const std::vector<bool> &v) {
+        return std::count(v.begin(), v.end(), true);
+    });
+    sm.def("pack_bits", [](const py::array_t<bool, py::array::c_style> &a) {
+        py::array_t<uint8_t> out(std::vector<py::ssize_t>{(a.size() + 7) / 8});
+        py::pack_bits(a.data(), static_cast<size_t>(a.size()), out.mutable_data());
+        return out;
+    });
+    sm.def("unpack_bits", [](const py::array_t<uint8_t, py::array::c_style> &a, size_t count) {
+        py::array_t<bool> out(std::vector<py::ssize_t>{static_cast<py::ssize_t>(count)});
+        py::unpack_bits(a.data(), count, out.mutable_data());
+        return out;
+    });
+
+    // test_mem_handler
+    sm.attr("counting_mem_handler") = py::make_numpy_mem_handler(
+        "pybind11_test_counting", CountingAllocator<unsigned char>(&mem_handler_counter));
+    sm.def("allocation_counts", []() {
+        return py::make_tuple(mem_handler_counter.allocations, mem_handler_counter.live_bytes);
+    });
+    sm.def("set_mem_handler", &py::set_numpy_mem_handler);
+    sm.def("zeros_in_scope", [](py::handle handler, py::ssize_t n) {
+        py::numpy_allocator_scope scope(handler);
+        return py::array_t<double>(n);
+    });
 }
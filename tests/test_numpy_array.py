@@ -666,3 +666,90 @@ def test_return_array_pyobject_ptr_cpp_loop(return_array_pyobject_ptr, unwrap):
     assert isinstance(arr_from_list, np.ndarray)
     assert arr_from_list.dtype == np.dtype("O")
     assert unwrap(arr_from_list) == [6, "seven", -8.0]
+
+
+@pytest.mark.skipif(
+    np.lib.NumpyVersion(np.__version__) < "1.22.0",
+    reason="NEP 49 memory handlers require numpy >= 1.22",
+)
+def test_mem_handler():
+    try:
+        from numpy._core import multiarray
+    except ImportError:
+        from numpy.core import multiarray
+
+    handler = m.counting_mem_handler
+    allocations, live_bytes = m.allocation_counts()
+
+    a = m.zeros_in_scope(handler, 1000)
+    assert multiarray.get_handler_name(a) == "pybind11_test_counting"
+    assert m.allocation_counts()[0] == allocations + 1
+    assert m.allocation_counts()[1] >= live_bytes + 8000
+    # the previous handler is restored when the scope ends
+    b = np.ones(10)
+    assert multiarray.get_handler_name(b) != "pybind11_test_counting"
+    del a
+    assert m.allocation_counts()[1] == live_bytes
+
+    previous = m.set_mem_handler(handler)
+    try:
+        c = np.arange(100.0)
+        c.resize(1000, refcheck=False)
+        assert c[99] == 99.0
+        assert c[999] == 0.0
+        assert multiarray.get_handler_name(c) == "pybind11_test_counting"
+    finally:
+        assert m.set_mem_handler(previous) is handler
+    assert m.allocation_counts()[0] >= allocations + 3
+    del c
+    assert m.allocation_counts()[1] == live_bytes
+
+
+def test_nested_vectors():
+    a = m.nested_as_ndarray(2, 3)
+    assert a.dtype == np.float64
+    np.testing.assert_array_equal(a, [[0, 1, 2], [10, 11, 12]])
+    assert m.nested_as_ndarray(0, 0).shape == (0, 0)
+    v = m.vector_as_ndarray()
+    assert v.dtype == np.float32
+    np.testing.assert_array_equal(v, [1, 2])
+    with pytest.raises(ValueError, match="different lengths"):
+        m.ragged_as_ndarray()
+    assert "numpy.ndarray[numpy.float64]" in m.nested_as_ndarray.__doc__
+
+    x = np.arange(12, dtype=np.float64).reshape(3, 4)
+    for arr in (x, x.T, x[::-1, ::2], x.astype(np.int32), x.astype(np.float32)):
+        assert m.echo_nested(arr) == arr.tolist()
+    assert m.echo_nested(m.nested_as_ndarray(2, 2)) == [[0.0, 1.0], [10.0, 11.0]]
+
+
+def test_bitsets():
+    rng = np.random.default_rng(0)
+    mask = rng.random(70) < 0.5
+    out = m.echo_bitset(mask)
+    assert out.dtype == np.bool_
+    np.testing.assert_array_equal(out, mask)
+    np.testing.assert_array_equal(m.echo_bitset(np.packbits(mask)), mask)
+    np.testing.assert_array_equal(m.echo_bitset(mask.tolist()), mask)
+    assert m.bitset_count(np.ones(26, dtype=bool)[::2]) == 13
+    assert m.bitset_count(np.packbits(np.ones(13, dtype=bool))) == 13
+    with pytest.raises(TypeError):
+        m.echo_bitset(mask[:69])
+    with pytest.raises(TypeError):
+        m.bitset_count(np.ones(13, dtype=np.int8))
+    assert "numpy.ndarray[numpy.bool_[70]]" in m.echo_bitset.__doc__
+
+    assert m.mask_count(mask) == mask.sum()
+    assert m.mask_count(mask[::-3]) == mask[::-3].sum()
+    assert m.mask_count([True, False, True]) == 2
+
+    for n in (0, 5, 8, 64, 1001):
+        bits = rng.random(n) < 0.3
+        packed = m.pack_bits(bits)
+        np.testing.assert_array_equal(packed, np.packbits(bits))
+        np.testing.assert_array_equal(m.unpack_bits(packed, n), bits)
+    # any nonzero byte counts as true
+    np.testing.assert_array_equal(
+        m.pack_bits(np.array([0, 2, 0x80, 0xFF, 0, 0, 0, 1], np.uint8).view(bool)),
+        [0b01110001],
+    )
@@ -260,6 +260,70 @@ struct ElementList {
     std::vector<std::shared_ptr<ElementBase>> l;
 };
 
+// Engine-style object with an embedded reference count, held by py::intrusive_ptr
+class Counted {
+public:
+    explicit Counted(int v) : value(v) { print_created(this, v); }
+    Counted(const Counted &) = delete;
+    Counted &operator=(const Counted &) = delete;
+    virtual ~Counted() { print_destroyed(this); }
+    int refcount() const { return count; }
+
+    int value;
+
+private:
+    friend void intrusive_ptr_add_ref(Counted *p) { ++p->count; }
+    friend void intrusive_ptr_release(Counted *p) {
+        if (--p->count == 0) {
+            delete p;
+        }
+    }
+    int count = 0;
+};
+
+// Puts the Counted base of CountedMI at a nonzero offset
+struct CountedPad {
+    virtual ~CountedPad() = default;
+    int pad = 7;
+};
+
+class CountedMI : public CountedPad, public Counted {
+public:
+    explicit CountedMI(int v) : Counted(v) {}
+};
+
+// Stands in for C++ code that keeps objects alive independently of Python
+std::vector<py::intrusive_ptr<Counted>> &counted_registry() {
+    static std::vector<py::intrusive_ptr<Counted>> registry;
+    return registry;
+}
+
+// Tree whose nodes are allocated in one block by their arena and exposed via py::arena_ref
+struct ArenaNode {
+    int value = 0;
+    std::vector<ArenaNode *> children;
+};
+
+class NodeArena {
+public:
+    explicit NodeArena(std::size_t n) : nodes(n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            nodes[i].value = static_cast<int>(i);
+            if (i > 0) {
+                nodes[(i - 1) / 2].children.push_back(&nodes[i]);
+            }
+        }
+        print_created(this, n);
+    }
+    NodeArena(const NodeArena &) = delete;
+    NodeArena &operator=(const NodeArena &) = delete;
+    ~NodeArena() { print_destroyed(this); }
+    ArenaNode *root() { return &nodes.front(); }
+
+private:
+    std::vector<ArenaNode> nodes;
+};
+
 } // namespace
 
 // ref<T> is a wrapper for 'Object' which uses intrusive reference counting
@@ -449,6 +513,56 @@ TEST_SUBMODULE(smart_ptr, m) {
         // NOLINTNEXTLINE(performance-unnecessary-value-param)
         .def_static("load_shared_ptr", [](std::shared_ptr<HeldByDefaultHolder>) {});
 
+    // test_intrusive_ptr
+    py::class_<Counted, py::intrusive_ptr<Counted>>(m, "Counted")
+        .def(py::init<int>())
+        .def_readonly("value", &Counted::value)
+        .def("refcount", &Counted::refcount);
+    m.def("make_counted", [](int value) { return new Counted(value); });
+    m.def("make_counted_holder",
+          [](int value) { return py::intrusive_ptr<Counted>(new Counted(value)); });
+    m.def("keep_counted", [](py::intrusive_ptr<Counted> p) { counted_registry().push_back(p); });
+    m.def(
+        "kept_counted",
+        [](std::size_t i) { return counted_registry().at(i).get(); },
+        py::return_value_policy::reference);
+    m.def("release_kept_counted", []() { counted_registry().clear(); });
+    m.def("counted_value", [](const Counted &c) { return c.value; });
+    py::class_<CountedPad, std::shared_ptr<CountedPad>>(m, "CountedPad")
+        .def_readonly("pad", &CountedPad::pad);
+    py::class_<CountedMI, CountedPad, Counted, py::intrusive_ptr<CountedMI>>(m, "CountedMI");
+    m.def("make_counted_mi",
+          [](int value) { return py::intrusive_ptr<Counted>(new CountedMI(value)); });
+    m.def("counted_holder_value", [](const py::intrusive_ptr<Counted> &p) { return p->value; });
+    m.def("counted_holder_size", []() {
+        return py::detail::get_type_info(typeid(Counted))->holder_size_in_ptrs;
+    });
+
+    // test_arena_ref
+    py::class_<NodeArena>(m, "NodeArena")
+        .def(py::init<std::size_t>())
+        .def("root", [](const py::object &self) {
+            ArenaNode *root = self.cast<NodeArena &>().root();
+            return py::arena_ref<ArenaNode>(root, self);
+        });
+    py::class_<ArenaNode, py::arena_ref<ArenaNode>>(m, "ArenaNode")
+        .def_readonly("value", &ArenaNode::value)
+        .def("children",
+             [](const py::arena_ref<ArenaNode> &self) {
+                 py::list children;
+                 for (auto *child : self->children) {
+                     children.append(self.rebind(child));
+                 }
+                 return children;
+             })
+        .def("anchor", [](const py::arena_ref<ArenaNode> &self) { return self.anchor(); });
+    m.def("detached_arena_node", [](int value) {
+        ArenaNode node;
+        node.value = value;
+        return node;
+    });
+    m.def("patient_count", []() { return py::detail::get_internals().patients.size(); });
+
     // test_shared_ptr_gc
     // #187: issue involving std::shared_ptr<> return value policy & garbage collection
     py::class_<ElementBase, std::shared_ptr<ElementBase>>(m, "ElementBase");
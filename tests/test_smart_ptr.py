@@ -313,3 +313,81 @@ def test_shared_ptr_gc():
     pytest.gc_collect()
     for i, v in enumerate(el.get()):
         assert i == v.value()
+
+
+def test_intrusive_ptr():
+    cstats = ConstructorStats.get(m.Counted)
+    # The holder lives in the value pointer slot and takes no extra space
+    assert m.counted_holder_size() == 0
+
+    # Raw pointers and holders both share the object's own count
+    for make in (m.make_counted, m.make_counted_holder, m.Counted):
+        o = make(1)
+        assert o.refcount() == 1
+        assert m.counted_value(o) == 1
+        del o
+        assert cstats.alive() == 0
+
+    # C++ keeps the object alive after Python drops it...
+    o = m.Counted(2)
+    m.keep_counted(o)
+    assert o.refcount() == 2
+    del o
+    assert cstats.alive() == 1
+
+    # ... and even a non-owning cast takes a reference rather than aliasing it
+    o = m.kept_counted(0)
+    assert o.value == 2
+    assert o.refcount() == 2
+    m.release_kept_counted()
+    assert o.refcount() == 1
+    assert cstats.alive() == 1
+    del o
+    assert cstats.alive() == 0
+
+
+def test_intrusive_ptr_non_primary_base():
+    cstats = ConstructorStats.get(m.Counted)
+    # Returned through a holder pointing at the Counted subobject, which is not at the start of
+    # the most derived object
+    o = m.make_counted_mi(3)
+    assert isinstance(o, m.CountedMI)
+    assert o.pad == 7
+    assert o.value == 3
+    assert o.refcount() == 1
+    assert m.counted_value(o) == 3
+    assert m.counted_holder_value(o) == 3
+    m.keep_counted(o)
+    assert o.refcount() == 2
+    m.release_kept_counted()
+    assert o.refcount() == 1
+    del o
+    assert cstats.alive() == 0
+
+
+def test_arena_ref():
+    cstats = ConstructorStats.get(m.NodeArena)
+    patients = m.patient_count()
+    arena = m.NodeArena(7)
+    root = arena.root()
+    assert root is arena.root()
+    assert root.anchor() is arena
+    kids = root.children()
+    assert [k.value for k in kids] == [1, 2]
+    assert [g.value for k in kids for g in k.children()] == [3, 4, 5, 6]
+    assert all(k.anchor() is arena for k in kids)
+    # Wrappers share the arena through their holders, not through keep_alive patients
+    assert m.patient_count() == patients
+
+    del arena, root
+    pytest.gc_collect()
+    assert cstats.alive() == 1
+    del kids
+    pytest.gc_collect()
+    assert cstats.alive() == 0
+
+    # A node that does not live in an arena owns itself
+    node = m.detached_arena_node(5)
+    assert node.value == 5
+    assert node.children() == []
+    assert node.anchor() is not None
@@ -17,6 +17,8 @@
 #endif
 #include <pybind11/stl/filesystem.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -185,6 +187,19 @@ TEST_SUBMODULE(stl, m) {
         },
         py::return_value_policy::reference);
 
+    // test_vector_from_buffer
+    m.def("echo_vector_double", [](const std::vector<double> &v) { return v; });
+    m.def(
+        "echo_vector_int16_noconvert",
+        [](const std::vector<std::int16_t> &v) { return v; },
+        py::arg().noconvert());
+    m.def("echo_vector_uint8", [](const std::vector<std::uint8_t> &v) { return v; });
+    m.def("echo_nested_double", [](const std::vector<std::vector<double>> &v) { return v; });
+    m.def(
+        "echo_nested_int_noconvert",
+        [](const std::vector<std::vector<int>> &v) { return v; },
+        py::arg().noconvert());
+
     // test_deque
     m.def("cast_deque", []() { return std::deque<int>{1}; });
     m.def("load_deque", [](const std::deque<int> &v) { return v.at(0) == 1 && v.at(1) == 2; });
@@ -299,6 +314,18 @@ TEST_SUBMODULE(stl, m) {
     py::class_<MoveOutDetector>(m, "MoveOutDetector", "Class with move tracking")
         .def(py::init<>())
         .def_readonly("initialized", &MoveOutDetector::initialized);
+    m.def("move_out_detectors", [](std::size_t n) { return std::vector<MoveOutDetector>(n); });
+    static std::vector<MoveOutDetector> kept_detectors(2);
+    m.def(
+        "kept_detectors",
+        []() -> const std::vector<MoveOutDetector> & { return kept_detectors; },
+        py::return_value_policy::copy);
+    m.def("kept_detectors_initialized", []() {
+        return std::all_of(kept_detectors.begin(),
+                           kept_detectors.end(),
+                           [](const MoveOutDetector &d) { return d.initialized; });
+    });
+    m.def("no_assign_deque", []() { return std::deque<NoAssign>{NoAssign(1), NoAssign(2)}; });
 
 #ifdef PYBIND11_HAS_OPTIONAL
     // test_optional
@@ -473,6 +500,28 @@ TEST_SUBMODULE(stl, m) {
 #    endif
 #endif
 
+#if defined(PYBIND11_HAS_SPAN)
+    // test_span
+    m.attr("has_span") = true;
+    m.def("span_sum", [](std::span<const double> s) {
+        double total = 0;
+        for (double d : s) {
+            total += d;
+        }
+        return total;
+    });
+    m.def("span_scale", [](std::span<double> s, double factor) {
+        for (double &d : s) {
+            d *= factor;
+        }
+    });
+    m.def("span_fill_bytes", [](std::span<std::uint8_t> s, std::uint8_t v) {
+        std::fill(s.begin(), s.end(), v);
+    });
+    m.def("span_fixed", [](std::span<const int, 3> s) { return s[0] * 100 + s[1] * 10 + s[2]; });
+    m.def("span_roundtrip", [](std::span<const int> s) { return s; });
+#endif
+
     // #528: templated constructor
     // (no python tests: the test here is that this compiles)
     m.def("tpl_ctor_vector", [](std::vector<TplCtorClass> &) {});
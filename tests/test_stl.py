@@ -23,6 +23,30 @@ def test_vector(doc):
     assert m.cast_ptr_vector() == ["lvalue", "lvalue"]
 
 
+def test_vector_from_buffer():
+    from array import array
+
+    assert m.echo_vector_double(array("d", [1.5, 2.5])) == [1.5, 2.5]
+    assert m.echo_vector_double(array("i", [1, -2])) == [1.0, -2.0]
+    assert m.echo_vector_double(memoryview(array("f", [0.5, 1, 2]))[::-2]) == [2.0, 0.5]
+    assert m.echo_vector_uint8(bytearray(b"\x01\xff")) == [1, 255]
+    # integers of another width are accepted if they fit, like with the element-wise path
+    assert m.echo_vector_int16_noconvert(array("q", [-3, 32767])) == [-3, 32767]
+    with pytest.raises(TypeError):
+        m.echo_vector_int16_noconvert(array("q", [32768]))
+    with pytest.raises(TypeError):
+        m.echo_vector_int16_noconvert(array("d", [1.0]))
+    with pytest.raises(TypeError):
+        m.echo_vector_uint8(array("b", [-1]))
+
+    rows = memoryview(array("d", range(6))).cast("B").cast("d", [2, 3])
+    assert m.echo_nested_double(rows) == [[0.0, 1.0, 2.0], [3.0, 4.0, 5.0]]
+    ints = memoryview(array("i", range(6))).cast("B").cast("i", [3, 2])
+    assert m.echo_nested_double(ints) == [[0.0, 1.0], [2.0, 3.0], [4.0, 5.0]]
+    assert m.echo_nested_int_noconvert(ints) == [[0, 1], [2, 3], [4, 5]]
+    assert m.echo_nested_double([[1, 2], [3]]) == [[1.0, 2.0], [3.0]]
+
+
 def test_deque():
     """std::deque <-> list"""
     lst = m.cast_deque()
@@ -112,6 +136,21 @@ def test_move_out_container():
     assert [x.value for x in moved_out_list] == [0, 1, 2]
 
 
+def test_move_out_registered_values():
+    """Containers of registered types returned by value are cast in bulk; each element still
+    becomes its own instance that owns a moved-out value."""
+    detectors = m.move_out_detectors(1000)
+    assert len(detectors) == 1000
+    assert len({id(d) for d in detectors}) == 1000
+    assert all(d.initialized for d in detectors)
+    assert [type(x) for x in m.no_assign_deque()] == [m.NoAssign, m.NoAssign]
+
+    # lvalue containers are copied, never moved from
+    kept = m.kept_detectors()
+    assert [d.initialized for d in kept] == [True, True]
+    assert m.kept_detectors_initialized()
+
+
 @pytest.mark.skipif(not hasattr(m, "has_optional"), reason="no <optional>")
 def test_optional():
     assert m.double_or_zero(None) == 0
@@ -287,6 +326,43 @@ def test_variant_monostate(doc):
     )
 
 
+@pytest.mark.skipif(not hasattr(m, "has_span"), reason="no <span>")
+def test_span():
+    from array import array
+
+    assert m.span_sum(array("d", [1.0, 2.0, 3.5])) == 6.5
+    assert m.span_sum(memoryview(array("d", [4.0]))) == 4.0
+    # const spans fall back to a converted copy
+    assert m.span_sum([1, 2, 3]) == 6.0
+    assert m.span_sum(array("i", [1, 2])) == 3.0
+
+    # mutable spans write through to the buffer, never into a copy
+    a = array("d", [1.0, 2.0])
+    m.span_scale(a, 3.0)
+    assert a.tolist() == [3.0, 6.0]
+    m.span_scale(memoryview(a), 0.5)
+    assert a.tolist() == [1.5, 3.0]
+    with pytest.raises(TypeError):
+        m.span_scale([1.0, 2.0], 2.0)
+    with pytest.raises(TypeError):
+        m.span_scale(array("f", [1.0]), 2.0)
+    with pytest.raises(TypeError):
+        m.span_scale(memoryview(a).toreadonly(), 2.0)
+    with pytest.raises(TypeError):
+        m.span_scale(memoryview(array("d", [1.0, 2.0, 3.0]))[::2], 2.0)
+
+    b = bytearray(4)
+    m.span_fill_bytes(b, 7)
+    assert b == bytearray([7, 7, 7, 7])
+
+    assert m.span_fixed(array("i", [1, 2, 3])) == 123
+    assert m.span_fixed([4, 5, 6]) == 456
+    with pytest.raises(TypeError):
+        m.span_fixed(array("i", [1, 2]))
+
+    assert m.span_roundtrip(array("i", [5, 6])) == [5, 6]
+
+
 def test_vec_of_reference_wrapper():
     """#171: Can't return reference wrappers (or STL structures containing them)"""
     assert (
@@ -1,3 +1,6 @@
+import pickle
+import sys
+
 import pytest
 
 from pybind11_tests import stl_binders as m
@@ -124,6 +127,70 @@ def test_vector_buffer_numpy():
     assert v[1] == 3
 
 
+def test_vector_buffer_bulk_modifiers():
+    np = pytest.importorskip("numpy")
+    v = m.VectorInt([1, 2])
+    v.extend(np.array([3, 4, 5], dtype=np.uintc))
+    assert v == m.VectorInt([1, 2, 3, 4, 5])
+
+    # Strided and reversed sources
+    a = np.arange(12, dtype=np.uintc).reshape(3, 4)
+    v.extend(a[:, 1])
+    assert v == m.VectorInt([1, 2, 3, 4, 5, 1, 5, 9])
+    v.extend(a[0, ::-1])
+    assert list(v) == [1, 2, 3, 4, 5, 1, 5, 9, 3, 2, 1, 0]
+
+    # Formats requiring conversion fall back to the element-wise path
+    v = m.VectorInt()
+    v.extend(np.array([7, 8], dtype=np.int64))
+    assert v == m.VectorInt([7, 8])
+    with pytest.raises(RuntimeError):
+        v.extend(np.array([1.5, 2.5]))
+    assert v == m.VectorInt([7, 8])
+
+    v += np.array([9], dtype=np.uintc)
+    v += [10]
+    assert v == m.VectorInt([7, 8, 9, 10])
+
+    v[1:3] = np.array([80, 90], dtype=np.uintc)
+    assert v == m.VectorInt([7, 80, 90, 10])
+    v[::2] = np.array([1, 2, 3, 4], dtype=np.uintc)[::2]
+    assert v == m.VectorInt([1, 80, 3, 10])
+    with pytest.raises(RuntimeError):
+        v[0:2] = np.array([1, 2, 3], dtype=np.uintc)
+    # Formats requiring conversion fall back to the element-wise path here too
+    v[0:2] = np.array([5, 6], dtype=np.int64)
+    assert v == m.VectorInt([5, 6, 3, 10])
+    with pytest.raises(RuntimeError):
+        v[0:2] = np.array([1.5, 2.5])
+    assert v == m.VectorInt([5, 6, 3, 10])
+
+
+def test_vector_buffer_self_alias():
+    v = m.VectorUChar(bytearray([1, 2, 3]))
+    v.extend(v)
+    assert list(v) == [1, 2, 3, 1, 2, 3]
+    v += memoryview(v)[::-2]
+    assert list(v) == [1, 2, 3, 1, 2, 3, 3, 1, 2]
+    v[1:4] = memoryview(v)[0:3]
+    assert list(v) == [1, 1, 2, 3, 2, 3, 3, 1, 2]
+
+
+def test_vector_buffer_slice_conversion():
+    from array import array
+
+    v = m.VectorInt([0, 0, 0])
+    v[::2] = array("q", [5, 6])
+    assert list(v) == [5, 0, 6]
+    v[0:2] = array("B", [1, 2])
+    assert list(v) == [1, 2, 6]
+    with pytest.raises(RuntimeError):
+        v[0:2] = array("b", [-1, -2])
+    with pytest.raises(RuntimeError):
+        v[0:2] = array("q", [1, 2, 3])
+    assert list(v) == [1, 2, 6]
+
+
 def test_vector_bool():
     import pybind11_cross_module_tests as cm
 
@@ -193,6 +260,85 @@ def test_map_string_double():
     assert "UnorderedMapStringDouble" in str(um)
 
 
+def test_map_bulk_update_and_export():
+    mm = m.MapStringDouble()
+    mm.update({"a": 1, "b": 2.5})
+    assert mm.to_dict() == {"a": 1, "b": 2.5}
+
+    # Existing keys are overwritten, new keys are inserted
+    mm.update({"b": 3.5, "c": 4})
+    assert mm.to_dict() == {"a": 1, "b": 3.5, "c": 4}
+
+    other = m.MapStringDouble()
+    other["d"] = 5
+    mm.update(other)
+    mm.update(mm)
+    mm.update([("e", 6)])
+    mm.update(zip(["f"], [7]))
+    assert mm.to_dict() == {"a": 1, "b": 3.5, "c": 4, "d": 5, "e": 6, "f": 7}
+
+    with pytest.raises(RuntimeError):
+        mm.update({"g": "not a number"})
+    with pytest.raises(TypeError):
+        mm.update(1)
+
+    mc = m.UnorderedMapStringDoubleConst()
+    mc.update({"a": 1})
+    mc.update({"a": 2})
+    assert mc.to_dict() == {"a": 2}
+
+    assert not hasattr(m.MapENC, "to_dict")
+    assert not hasattr(m.MapStringDouble, "to_arrays")
+
+
+def test_map_to_arrays():
+    np = pytest.importorskip("numpy")
+    mi = m.MapIntDouble()
+    keys, values = mi.to_arrays()
+    assert keys.shape == values.shape == (0,)
+
+    mi.update({3: 0.5, 1: 1.5, 2: 2.5})
+    keys, values = mi.to_arrays()
+    assert keys.dtype == np.intc
+    assert values.dtype == np.float64
+    np.testing.assert_array_equal(keys, [1, 2, 3])
+    np.testing.assert_array_equal(values, [1.5, 2.5, 0.5])
+
+
+def test_pickle_arithmetic_containers():
+    v = m.VectorInt([1, 2, 3, 2**32 - 1])
+    v2 = pickle.loads(pickle.dumps(v, pickle.HIGHEST_PROTOCOL))
+    assert v2 == v
+    assert pickle.loads(pickle.dumps(m.VectorInt())) == m.VectorInt()
+    # large enough to be copied with the GIL released
+    big = m.VectorInt(range(300000))
+    assert pickle.loads(pickle.dumps(big, pickle.HIGHEST_PROTOCOL)) == big
+
+    fmt, itemsize, byteorder, data = v.__getstate__()
+    assert itemsize == 4
+    assert byteorder == sys.byteorder
+    assert len(data) == 16
+
+    # Pickles written on a machine of the opposite endianness are byte swapped
+    swapped = b"".join(data[i : i + 4][::-1] for i in range(0, len(data), 4))
+    other = "big" if sys.byteorder == "little" else "little"
+    v3 = m.VectorInt.__new__(m.VectorInt)
+    v3.__setstate__((fmt, itemsize, other, swapped))
+    assert v3 == v
+
+    with pytest.raises(ValueError):
+        m.VectorUChar.__new__(m.VectorUChar).__setstate__(v.__getstate__())
+
+    mi = m.MapIntDouble()
+    mi.update({5: 0.5, -1: 1.5, 3: 2.5})
+    mi2 = pickle.loads(pickle.dumps(mi))
+    assert mi2.to_dict() == {-1: 1.5, 3: 2.5, 5: 0.5}
+
+    # Only containers of arithmetic types get the binary pickling support
+    with pytest.raises(TypeError):
+        pickle.dumps(m.MapStringDouble())
+
+
 def test_map_string_double_const():
     mc = m.MapStringDoubleConst()
     mc["a"] = 10